@@ -0,0 +1,561 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2021 Alessandro Morniroli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file   bench.c
+ * @author Alessandro Morniroli <alessandro.morniroli@gmail.com>
+ * @date   Sun Oct 18 2026
+ *
+ * @brief  Mem pool microbenchmarks (CSV output, see "make bench").
+ *
+ * Every allocator variant is instantiated through BENCH_VARIANT, so that the
+ * measured loops call the pool routines directly (no function pointers).
+ * Latencies are sampled over batches of BENCH_BATCH operations, to keep
+ * clock_gettime overhead out of the figures.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "memPool.h"
+#include "memPoolInline.h"
+#include "memPoolMag.h"
+#include "memPoolMt.h"
+
+#define BENCH_SLOT_SIZE   64U
+#define BENCH_SLOTS       4096U
+#define BENCH_BATCH       32U
+#define BENCH_SAMPLES     20000U
+#define BENCH_ROUNDS      200U
+#define BENCH_MT_PAIRS    1000000U
+#define BENCH_MT_BURST    8U
+#define BENCH_MAX_THREADS 8U
+#define BENCH_INIT_MAX    (1024U * 1024U)
+
+typedef enum
+{
+    BENCH_ORDER_LIFO,
+    BENCH_ORDER_FIFO,
+    BENCH_ORDER_RANDOM
+} bench_order_t;
+
+static uint8_t*           benchStorage;
+static uint32_t*          benchBitmap;
+static memPool_index_t*   benchIndex;
+static memPool_handle_t   benchPool;
+static memPool_handle_t   benchPoolBitmap;
+static memPool_handle_t   benchPoolIndex;
+static memPoolMt_handle_t benchPoolMt;
+
+static _Thread_local memPoolMag_t benchMagazine;
+
+static uint8_t* benchFreeListHead;
+
+MEM_POOL_INLINE_DEFINE (benchPoolInline, BENCH_SLOT_SIZE, BENCH_SLOTS)
+
+static double  benchSamples[BENCH_SAMPLES];
+static void*   benchSlots[BENCH_SLOTS];
+static uint32_t benchOrder[BENCH_SLOTS];
+
+static uint64_t
+bench_now (void)
+{
+    struct timespec ts;
+
+    (void) clock_gettime (CLOCK_MONOTONIC, &ts);
+
+    return (((uint64_t) ts.tv_sec) * 1000000000U) + ((uint64_t) ts.tv_nsec);
+}
+
+static int
+bench_compare (const void* ptrA, const void* ptrB)
+{
+    double a = *((const double*) ptrA);
+    double b = *((const double*) ptrB);
+
+    return (a > b) - (a < b);
+}
+
+static void
+bench_report (const char* ptrBench, const char* ptrVariant, uint32_t slots, uint32_t threads, double* ptrSamples,
+              uint32_t number)
+{
+    double   mean;
+    uint32_t i;
+
+    mean = 0.0;
+
+    for (i = 0U; i < number; i++)
+    {
+        mean += ptrSamples[i];
+    }
+
+    mean /= (double) number;
+
+    qsort (ptrSamples, number, sizeof (*ptrSamples), bench_compare);
+
+    printf ("%s,%s,%u,%u,%u,%.2f,%.2f,%.2f,%.2f,%.2f\n", ptrBench, ptrVariant, slots, threads, number, mean,
+            ptrSamples[(number * 50U) / 100U], ptrSamples[(number * 90U) / 100U], ptrSamples[(number * 99U) / 100U],
+            ptrSamples[(number * 999U) / 1000U]);
+    (void) fflush (stdout);
+}
+
+/* Allocator variants. */
+
+static inline void*
+poolAlloc (void)
+{
+    uint8_t* ptr;
+
+    (void) memPool_alloc (&benchPool, &ptr);
+
+    return ptr;
+}
+
+static inline void
+poolFree (void* ptr)
+{
+    (void) memPool_free (&benchPool, (uint8_t*) ptr);
+}
+
+static inline void
+poolSetup (uint32_t slots)
+{
+    (void) memPool_init (&benchPool, benchStorage, BENCH_SLOT_SIZE, slots);
+}
+
+static inline void*
+poolBitmapAlloc (void)
+{
+    uint8_t* ptr;
+
+    (void) memPool_alloc (&benchPoolBitmap, &ptr);
+
+    return ptr;
+}
+
+static inline void
+poolBitmapFree (void* ptr)
+{
+    (void) memPool_free (&benchPoolBitmap, (uint8_t*) ptr);
+}
+
+static inline void
+poolBitmapSetup (uint32_t slots)
+{
+    (void) memPool_initBitmap (&benchPoolBitmap, benchStorage, benchBitmap, BENCH_SLOT_SIZE, slots);
+}
+
+static inline void*
+poolIndexAlloc (void)
+{
+    uint8_t* ptr;
+
+    (void) memPool_alloc (&benchPoolIndex, &ptr);
+
+    return ptr;
+}
+
+static inline void
+poolIndexFree (void* ptr)
+{
+    (void) memPool_free (&benchPoolIndex, (uint8_t*) ptr);
+}
+
+static inline void
+poolIndexSetup (uint32_t slots)
+{
+    (void) memPool_initIndex (&benchPoolIndex, benchStorage, benchBitmap, benchIndex, BENCH_SLOT_SIZE, slots);
+}
+
+static inline void*
+poolInlineAlloc (void)
+{
+    uint8_t* ptr;
+
+    (void) benchPoolInline_alloc (&ptr);
+
+    return ptr;
+}
+
+static inline void
+poolInlineFree (void* ptr)
+{
+    (void) benchPoolInline_free ((uint8_t*) ptr);
+}
+
+static inline void
+poolInlineSetup (uint32_t slots)
+{
+    /* Slot number is a constant. */
+    (void) slots;
+    benchPoolInline_reset ();
+}
+
+/* Hand-written intrusive free list (baseline of the inline pool). */
+
+static inline void*
+freeListAlloc (void)
+{
+    uint8_t* ptr;
+
+    ptr = benchFreeListHead;
+
+    if (ptr != NULL)
+    {
+        benchFreeListHead = *((uint8_t**) ptr);
+    }
+
+    return ptr;
+}
+
+static inline void
+freeListFree (void* ptr)
+{
+    *((uint8_t**) ptr) = benchFreeListHead;
+    benchFreeListHead  = (uint8_t*) ptr;
+}
+
+static inline void
+freeListSetup (uint32_t slots)
+{
+    uint32_t i;
+
+    benchFreeListHead = NULL;
+
+    for (i = slots; i > 0U; i--)
+    {
+        freeListFree (&benchStorage[((i - 1U) * BENCH_SLOT_SIZE)]);
+    }
+}
+
+static inline void*
+poolMtAlloc (void)
+{
+    uint8_t* ptr;
+
+    (void) memPoolMt_alloc (&benchPoolMt, &ptr);
+
+    return ptr;
+}
+
+static inline void
+poolMtFree (void* ptr)
+{
+    (void) memPoolMt_free (&benchPoolMt, (uint8_t*) ptr);
+}
+
+static inline void
+poolMtSetup (uint32_t slots)
+{
+    (void) memPoolMt_init (&benchPoolMt, benchStorage, (_Atomic uint32_t*) benchBitmap, BENCH_SLOT_SIZE, slots);
+}
+
+static inline void*
+poolMagAlloc (void)
+{
+    uint8_t* ptr;
+
+    (void) memPoolMag_alloc (&benchMagazine, &ptr);
+
+    return ptr;
+}
+
+static inline void
+poolMagFree (void* ptr)
+{
+    (void) memPoolMag_free (&benchMagazine, (uint8_t*) ptr);
+}
+
+static inline void
+poolMagSetup (uint32_t slots)
+{
+    poolMtSetup (slots);
+}
+
+static inline void*
+mallocAlloc (void)
+{
+    return malloc (BENCH_SLOT_SIZE);
+}
+
+static inline void
+mallocFree (void* ptr)
+{
+    free (ptr);
+}
+
+static inline void
+mallocSetup (uint32_t slots)
+{
+    (void) slots;
+}
+
+/* Magazines are bound to the pool by the thread using them. */
+#define BENCH_THREAD_ENTER_poolMag()  ((void) memPoolMag_init (&benchMagazine, &benchPoolMt))
+#define BENCH_THREAD_EXIT_poolMag()   ((void) memPoolMag_deinit (&benchMagazine))
+#define BENCH_THREAD_ENTER_default()
+#define BENCH_THREAD_EXIT_default()
+
+/**
+ * Instantiate the benchmarks of an allocator variant.
+ */
+#define BENCH_VARIANT(name, hooks)                                                                      \
+    static void                                                                                         \
+    name##_pairs (void)                                                                                 \
+    {                                                                                                   \
+        uint32_t s;                                                                                     \
+        uint32_t i;                                                                                     \
+                                                                                                        \
+        name##Setup (BENCH_SLOTS);                                                                      \
+        BENCH_THREAD_ENTER_##hooks ();                                                                  \
+                                                                                                        \
+        for (s = 0U; s < BENCH_SAMPLES; s++)                                                            \
+        {                                                                                               \
+            uint64_t t0 = bench_now ();                                                                 \
+                                                                                                        \
+            for (i = 0U; i < BENCH_BATCH; i++)                                                          \
+            {                                                                                           \
+                void* volatile ptr = name##Alloc ();                                                    \
+                name##Free (ptr);                                                                       \
+            }                                                                                           \
+                                                                                                        \
+            benchSamples[s] = ((double) (bench_now () - t0)) / BENCH_BATCH;                             \
+        }                                                                                               \
+                                                                                                        \
+        BENCH_THREAD_EXIT_##hooks ();                                                                   \
+        bench_report ("alloc_free_pair", #name, BENCH_SLOTS, 1U, benchSamples, BENCH_SAMPLES);          \
+    }                                                                                                   \
+                                                                                                        \
+    static void                                                                                         \
+    name##_order (bench_order_t order, const char* ptrBench)                                            \
+    {                                                                                                   \
+        uint32_t r;                                                                                     \
+        uint32_t i;                                                                                     \
+                                                                                                        \
+        name##Setup (BENCH_SLOTS);                                                                      \
+        BENCH_THREAD_ENTER_##hooks ();                                                                  \
+                                                                                                        \
+        for (r = 0U; r < BENCH_ROUNDS; r++)                                                             \
+        {                                                                                               \
+            uint64_t t0 = bench_now ();                                                                 \
+                                                                                                        \
+            for (i = 0U; i < BENCH_SLOTS; i++)                                                          \
+            {                                                                                           \
+                benchSlots[i] = name##Alloc ();                                                         \
+                *((volatile uint8_t*) benchSlots[i] + sizeof (void*)) = (uint8_t) i;                    \
+            }                                                                                           \
+                                                                                                        \
+            for (i = 0U; i < BENCH_SLOTS; i++)                                                          \
+            {                                                                                           \
+                name##Free (benchSlots[(order == BENCH_ORDER_LIFO) ? (BENCH_SLOTS - 1U - i) :           \
+                                       ((order == BENCH_ORDER_FIFO) ? i : benchOrder[i])]);             \
+            }                                                                                           \
+                                                                                                        \
+            benchSamples[r] = ((double) (bench_now () - t0)) / (2U * BENCH_SLOTS);                      \
+        }                                                                                               \
+                                                                                                        \
+        BENCH_THREAD_EXIT_##hooks ();                                                                   \
+        bench_report (ptrBench, #name, BENCH_SLOTS, 1U, benchSamples, BENCH_ROUNDS);                    \
+    }                                                                                                   \
+                                                                                                        \
+    static void*                                                                                        \
+    name##_worker (void* ptrArg)                                                                        \
+    {                                                                                                   \
+        void*    slots[BENCH_MT_BURST];                                                                 \
+        uint32_t pairs;                                                                                 \
+        uint32_t i;                                                                                     \
+        uint32_t j;                                                                                     \
+                                                                                                        \
+        pairs = (uint32_t) (uintptr_t) ptrArg;                                                          \
+        BENCH_THREAD_ENTER_##hooks ();                                                                  \
+                                                                                                        \
+        for (i = 0U; i < pairs; i += BENCH_MT_BURST)                                                    \
+        {                                                                                               \
+            for (j = 0U; j < BENCH_MT_BURST; j++)                                                       \
+            {                                                                                           \
+                slots[j] = name##Alloc ();                                                              \
+            }                                                                                           \
+                                                                                                        \
+            for (j = 0U; j < BENCH_MT_BURST; j++)                                                       \
+            {                                                                                           \
+                name##Free (slots[j]);                                                                  \
+            }                                                                                           \
+        }                                                                                               \
+                                                                                                        \
+        BENCH_THREAD_EXIT_##hooks ();                                                                   \
+                                                                                                        \
+        return NULL;                                                                                    \
+    }                                                                                                   \
+                                                                                                        \
+    static void                                                                                         \
+    name##_scaling (void)                                                                               \
+    {                                                                                                   \
+        pthread_t threads[BENCH_MAX_THREADS];                                                           \
+        uint32_t  n;                                                                                    \
+        uint32_t  t;                                                                                    \
+                                                                                                        \
+        for (n = 1U; n <= BENCH_MAX_THREADS; n *= 2U)                                                   \
+        {                                                                                               \
+            uint64_t t0;                                                                                \
+            double   sample;                                                                            \
+                                                                                                        \
+            name##Setup (BENCH_SLOTS);                                                                  \
+            t0 = bench_now ();                                                                          \
+                                                                                                        \
+            for (t = 0U; t < n; t++)                                                                    \
+            {                                                                                           \
+                (void) pthread_create (&threads[t], NULL, name##_worker,                                \
+                                       (void*) (uintptr_t) (BENCH_MT_PAIRS / n));                       \
+            }                                                                                           \
+                                                                                                        \
+            for (t = 0U; t < n; t++)                                                                    \
+            {                                                                                           \
+                (void) pthread_join (threads[t], NULL);                                                 \
+            }                                                                                           \
+                                                                                                        \
+            /* Aggregate throughput: wall time per alloc/free pair. */                                  \
+            sample = ((double) (bench_now () - t0)) / BENCH_MT_PAIRS;                                   \
+            bench_report ("mt_scaling", #name, BENCH_SLOTS, n, &sample, 1U);                            \
+        }                                                                                               \
+    }
+
+BENCH_VARIANT (pool,       default)
+BENCH_VARIANT (poolBitmap, default)
+BENCH_VARIANT (poolIndex,  default)
+BENCH_VARIANT (poolInline, default)
+BENCH_VARIANT (freeList,   default)
+BENCH_VARIANT (poolMt,     default)
+BENCH_VARIANT (poolMag,    poolMag)
+BENCH_VARIANT (malloc,     default)
+
+static void
+bench_init (void)
+{
+    static const uint32_t sizes[] = { 1024U, 65536U, BENCH_INIT_MAX };
+    uint32_t              i;
+    uint32_t              s;
+
+    for (i = 0U; i < (sizeof (sizes) / sizeof (sizes[0])); i++)
+    {
+        for (s = 0U; s < BENCH_ROUNDS; s++)
+        {
+            uint64_t t0 = bench_now ();
+
+            poolSetup (sizes[i]);
+            benchSamples[s] = (double) (bench_now () - t0);
+        }
+
+        bench_report ("init", "pool", sizes[i], 1U, benchSamples, BENCH_ROUNDS);
+
+        for (s = 0U; s < BENCH_ROUNDS; s++)
+        {
+            uint64_t t0 = bench_now ();
+
+            poolBitmapSetup (sizes[i]);
+            benchSamples[s] = (double) (bench_now () - t0);
+        }
+
+        bench_report ("init", "poolBitmap", sizes[i], 1U, benchSamples, BENCH_ROUNDS);
+    }
+}
+
+int
+main (void)
+{
+    uint32_t i;
+    uint32_t seed;
+
+    benchStorage = (uint8_t*) aligned_alloc (BENCH_SLOT_SIZE, (size_t) BENCH_SLOT_SIZE * BENCH_INIT_MAX);
+    benchBitmap  = (uint32_t*) malloc (MEM_POOL_BITMAP_WORDS (BENCH_INIT_MAX) * sizeof (uint32_t));
+    benchIndex   = (memPool_index_t*) malloc (BENCH_INIT_MAX * sizeof (memPool_index_t));
+
+    if ((benchStorage == NULL) || (benchBitmap == NULL) || (benchIndex == NULL))
+    {
+        fprintf (stderr, "Out of memory\n");
+        return 1;
+    }
+
+    /* Random free order (fixed seed, Fisher-Yates shuffle). */
+    seed = 0x12345678U;
+
+    for (i = 0U; i < BENCH_SLOTS; i++)
+    {
+        benchOrder[i] = i;
+    }
+
+    for (i = BENCH_SLOTS - 1U; i > 0U; i--)
+    {
+        uint32_t j;
+        uint32_t tmp;
+
+        seed ^= seed << 13U;
+        seed ^= seed >> 17U;
+        seed ^= seed << 5U;
+
+        j             = seed % (i + 1U);
+        tmp           = benchOrder[i];
+        benchOrder[i] = benchOrder[j];
+        benchOrder[j] = tmp;
+    }
+
+    printf ("benchmark,variant,slots,threads,samples,mean_ns,p50_ns,p90_ns,p99_ns,p999_ns\n");
+
+    pool_pairs ();
+    poolBitmap_pairs ();
+    poolIndex_pairs ();
+    poolInline_pairs ();
+    freeList_pairs ();
+    poolMt_pairs ();
+    poolMag_pairs ();
+    malloc_pairs ();
+
+    pool_order (BENCH_ORDER_LIFO, "free_order_lifo");
+    pool_order (BENCH_ORDER_FIFO, "free_order_fifo");
+    pool_order (BENCH_ORDER_RANDOM, "free_order_random");
+    poolBitmap_order (BENCH_ORDER_RANDOM, "free_order_random");
+    poolIndex_order (BENCH_ORDER_RANDOM, "free_order_random");
+    poolInline_order (BENCH_ORDER_RANDOM, "free_order_random");
+    freeList_order (BENCH_ORDER_RANDOM, "free_order_random");
+    poolMt_order (BENCH_ORDER_RANDOM, "free_order_random");
+    malloc_order (BENCH_ORDER_LIFO, "free_order_lifo");
+    malloc_order (BENCH_ORDER_FIFO, "free_order_fifo");
+    malloc_order (BENCH_ORDER_RANDOM, "free_order_random");
+
+    bench_init ();
+
+    poolMt_scaling ();
+    poolMag_scaling ();
+    malloc_scaling ();
+
+    free (benchIndex);
+    free (benchBitmap);
+    free (benchStorage);
+
+    return 0;
+}
@@ -0,0 +1,116 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2021 Alessandro Morniroli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file   memPool_Conf.h
+ * @author Alessandro Morniroli <alessandro.morniroli@gmail.com>
+ * @date   Thu Nov 16 2023
+ *
+ * @brief  Memory pool configuration for benchmarks.
+ */
+
+#ifndef MEM_POOL_CONF_H__
+#define MEM_POOL_CONF_H__
+
+/**********************************************************************************************************************
+*           HEADER INCLUDE                                                                                            *
+**********************************************************************************************************************/
+
+/**
+ * If enabled, parameters function are checked (if not valid, \ref MEM_POOL_ERROR_PARAMETERS is returned)
+ */
+#define MEM_POOL_CHECK_PARAMS 1
+
+/**
+ * Assert disabled (for benchmark purpose).
+ */
+#define memPool_assert(pX)
+
+/**
+ * Slot is 'zeroize' (as calloc standard routine) when \ref memPool_get allocates a valid one.
+ */
+#define memPool_zeroize 0
+
+/**
+ * If enabled, \ref memPool_free does not check that a slot was allocated when the pool has no allocation bitmap: a
+ * double free corrupts the free list. By default the whole free list is walked (O(n)). Pools initialized through
+ * \ref memPool_initBitmap always use the bitmap (O(1)).
+ */
+#define MEM_POOL_UNCHECKED_FREE 1
+
+/**
+ * If enabled, pools keep statistics (slots in use, high water mark, allocs, frees and failures), see
+ * \ref memPool_getStats. No code nor memory is spent on statistics when disabled.
+ */
+#define MEM_POOL_STATS 0
+
+/**
+ * Number of per-thread counter shards of lock-free pools statistics (threads update different cache lines).
+ */
+#define MEM_POOL_STATS_SHARDS 4U
+
+/**
+ * Number of slots cached by each per-thread magazine (see memPoolMag.h); 0 to disable magazines. Magazines are refilled
+ * and flushed by half of this size.
+ */
+#define MEM_POOL_MAGAZINE_SIZE 64U
+
+/**
+ * Maximum number of size classes of a pool set (see memPoolSet.h); 0 to disable pool sets.
+ */
+#define MEM_POOL_SET_CLASSES 4U
+
+/**
+ * Largest slot size (bytes) of a pool set class (sizes the class lookup table).
+ */
+#define MEM_POOL_SET_MAX_SLOT_SIZE 256U
+
+/**
+ * Alignment (power of two, bytes) of growable pool chunks (see memPoolGrow.h), also their maximum size: the chunk of
+ * a slot is found in O(1) by masking the slot address.
+ */
+#define MEM_POOL_GROW_CHUNK_ALIGN 4096U
+
+/**
+ * If enabled, inline pools (see memPoolInline.h) check freed slots (range and slot boundary, O(1)). Disabled here: release build fast path,
+ * compared with a hand-written free list.
+ */
+#define MEM_POOL_INLINE_CHECKS 0
+
+/**********************************************************************************************************************
+*           PUBLIC DEFINES                                                                                            *
+**********************************************************************************************************************/
+
+/**********************************************************************************************************************
+*           PUBLIC TYPES                                                                                              *
+**********************************************************************************************************************/
+
+/**********************************************************************************************************************
+*           PUBLIC VARIABLES                                                                                          *
+**********************************************************************************************************************/
+
+/**********************************************************************************************************************
+*           PUBLIC FUNCTIONS PROTOTYPES                                                                               *
+**********************************************************************************************************************/
+
+#endif /* MEM_POOL_CONF_H__ */
+
@@ -29,19 +29,1934 @@
  */
 
 #include <assert.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <unistd.h>
 
 #include "memPool.h"
+#include "memPoolGrow.h"
+#include "memPoolInline.h"
+#include "memPoolMag.h"
+#include "memPoolMap.h"
+#include "memPoolMt.h"
+#include "memPoolObj.h"
+#include "memPoolQueue.h"
+#include "memPoolRemote.h"
+#include "memPoolSet.h"
+#include "memPoolShm.h"
+#include "memPoolTrace.h"
+#include "memPoolSnapshot.h"
 
 #define SLOTS 3U
 
+#define MT_THREADS    4U
+#define MT_SLOTS      64U
+#define MT_BURST      8U
+#define MT_ITERATIONS 20000U
+
+#define QUEUE_CELLS     16U
+#define QUEUE_PRODUCERS 2U
+#define QUEUE_MESSAGES  20000U
+#define QUEUE_THREADS   4U
+#define QUEUE_ROUNDS    2000U
+
+#define SHM_SLOTS    16U
+#define SHM_MESSAGES 1000U
+
 typedef struct
 {
     void*   ptr;
     uint8_t someData;
 } test_t;
 
+/* C++ wrapper unit test (mainCpp.cpp). */
+void
+test_cpp (void);
+
+static void
+test_bitmap (void)
+{
+    test_t           storage[SLOTS];
+    uint32_t         bitmap[MEM_POOL_BITMAP_WORDS (SLOTS)];
+    memPool_handle_t pool;
+    test_t*          ptrSlot;
+
+    assert (memPool_initBitmap (&pool, ((uint8_t*) storage), bitmap, sizeof(test_t), SLOTS) == MEM_POOL_OK);
+    assert (bitmap[0] == 0U);
+
+    assert (memPool_free (&pool, ((uint8_t*) &storage[1])) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+
+    assert (memPool_alloc (&pool, ((uint8_t**) &ptrSlot)) == MEM_POOL_OK);
+    assert (ptrSlot == &storage[0]);
+    assert (bitmap[0] == 0x1U);
+
+    assert (memPool_alloc (&pool, ((uint8_t**) &ptrSlot)) == MEM_POOL_OK);
+    assert (ptrSlot == &storage[1]);
+    assert (bitmap[0] == 0x3U);
+
+    /* Not on a slot boundary / outside pool. */
+    assert (memPool_free (&pool, (((uint8_t*) &storage[1]) + 1)) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+    assert (memPool_free (&pool, ((uint8_t*) &storage[SLOTS])) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+
+    assert (memPool_free (&pool, ((uint8_t*) &storage[0])) == MEM_POOL_OK);
+    assert (bitmap[0] == 0x2U);
+    assert (memPool_free (&pool, ((uint8_t*) &storage[0])) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+
+    assert (memPool_free (&pool, ((uint8_t*) &storage[1])) == MEM_POOL_OK);
+    assert (bitmap[0] == 0U);
+}
+
+static void
+test_lazyInit (void)
+{
+    test_t           storage[SLOTS];
+    memPool_handle_t pool;
+    test_t*          ptrSlot;
+    uint8_t          pattern[sizeof (storage)];
+
+    /* Init does not touch storage. */
+    (void) memset (storage, 0xA5, sizeof (storage));
+    (void) memset (pattern, 0xA5, sizeof (pattern));
+    assert (memPool_init (&pool, ((uint8_t*) storage), sizeof(test_t), SLOTS) == MEM_POOL_OK);
+    assert (memcmp (storage, pattern, sizeof (storage)) == 0);
+
+    /* Slot never handed out cannot be freed. */
+    assert (memPool_free (&pool, ((uint8_t*) &storage[2])) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+
+    assert (memPool_alloc (&pool, ((uint8_t**) &ptrSlot)) == MEM_POOL_OK);
+    assert (ptrSlot == &storage[0]);
+    assert (memPool_alloc (&pool, ((uint8_t**) &ptrSlot)) == MEM_POOL_OK);
+    assert (ptrSlot == &storage[1]);
+
+    /* Freed slots are reused first (LIFO), then bump pointer goes on. */
+    assert (memPool_free (&pool, ((uint8_t*) &storage[0])) == MEM_POOL_OK);
+    assert (memPool_alloc (&pool, ((uint8_t**) &ptrSlot)) == MEM_POOL_OK);
+    assert (ptrSlot == &storage[0]);
+    assert (memPool_alloc (&pool, ((uint8_t**) &ptrSlot)) == MEM_POOL_OK);
+    assert (ptrSlot == &storage[2]);
+    assert (memPool_alloc (&pool, ((uint8_t**) &ptrSlot)) == MEM_POOL_ERROR_SPACE);
+}
+
+static void
+test_stats (void)
+{
+    test_t           storage[SLOTS];
+    uint32_t         bitmap[MEM_POOL_BITMAP_WORDS (SLOTS)];
+    memPool_handle_t pool;
+    memPool_stats_t  stats;
+    test_t*          slots[SLOTS];
+
+    assert (memPool_initBitmap (&pool, ((uint8_t*) storage), bitmap, sizeof(test_t), SLOTS) == MEM_POOL_OK);
+
+    assert (memPool_allocBulk (&pool, ((uint8_t**) slots), 2U, NULL) == MEM_POOL_OK);
+    assert (memPool_free (&pool, ((uint8_t*) slots[1])) == MEM_POOL_OK);
+    assert (memPool_free (&pool, ((uint8_t*) slots[1])) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+    assert (memPool_alloc (&pool, ((uint8_t**) &slots[1])) == MEM_POOL_OK);
+    assert (memPool_allocBulk (&pool, ((uint8_t**) slots), 2U, NULL) == MEM_POOL_ERROR_SPACE);
+
+    assert (memPool_getStats (&pool, &stats) == MEM_POOL_OK);
+    assert (stats.inUse         == 2U);
+    assert (stats.highWater     == 2U);
+    assert (stats.allocs        == 3U);
+    assert (stats.frees         == 1U);
+    assert (stats.allocFailures == 1U);
+    assert (stats.freeFailures  == 1U);
+
+    /* Exhausted pool, as expected by caller (not asserted). */
+    assert (memPool_tryAlloc (&pool, ((uint8_t**) &slots[2])) == MEM_POOL_OK);
+    assert (memPool_tryAlloc (&pool, ((uint8_t**) &slots[2])) == MEM_POOL_ERROR_SPACE);
+    assert (slots[2] == NULL);
+}
+
+static void
+test_aligned (void)
+{
+    static uint8_t   storage[MEM_POOL_ALIGNED_STORAGE_SIZE (24U, 64U, SLOTS) + 1U];
+    memPool_handle_t pool;
+    uint32_t         slotNumber;
+    uint8_t*         ptrSlot;
+    uint32_t         i;
+
+    /* Slot too small for the intrusive free list. */
+    assert (memPool_init (&pool, storage, (sizeof (uint8_t*) - 1U), SLOTS) == MEM_POOL_ERROR_PARAMETERS);
+
+    /* Alignment not a power of two. */
+    assert (memPool_initAligned (&pool, storage, sizeof (storage), NULL, 24U, 48U, &slotNumber) != MEM_POOL_OK);
+
+    /* Misaligned storage: first slot & stride aligned, slot count reported. */
+    assert (memPool_initAligned (&pool, &storage[1], (sizeof (storage) - 1U), NULL, 24U, 64U, &slotNumber) ==
+            MEM_POOL_OK);
+    assert (slotNumber == SLOTS);
+    assert (pool.slotSize == 64U);
+
+    for (i = 0U; i < slotNumber; i++)
+    {
+        assert (memPool_alloc (&pool, &ptrSlot) == MEM_POOL_OK);
+        assert ((((uintptr_t) ptrSlot) % 64U) == 0U);
+    }
+
+    assert (memPool_alloc (&pool, &ptrSlot) == MEM_POOL_ERROR_SPACE);
+
+    /* Storage too small for a single aligned slot. */
+    assert (memPool_initAligned (&pool, storage, 32U, NULL, 24U, 4096U, &slotNumber) != MEM_POOL_OK);
+    assert (slotNumber == 0U);
+}
+
+static void
+test_bulk (void)
+{
+    test_t           storage[SLOTS];
+    uint32_t         bitmap[MEM_POOL_BITMAP_WORDS (SLOTS)];
+    memPool_handle_t pool;
+    test_t*          slots[SLOTS + 1U];
+    uint32_t         got;
+
+    assert (memPool_initBitmap (&pool, ((uint8_t*) storage), bitmap, sizeof(test_t), SLOTS) == MEM_POOL_OK);
+
+    /* All-or-nothing: not enough slots, nothing allocated. */
+    assert (memPool_allocBulk (&pool, ((uint8_t**) slots), (SLOTS + 1U), NULL) == MEM_POOL_ERROR_SPACE);
+    assert (slots[0] == NULL);
+    assert (bitmap[0] == 0U);
+
+    assert (memPool_allocBulk (&pool, ((uint8_t**) slots), 2U, NULL) == MEM_POOL_OK);
+    assert ((slots[0] == &storage[0]) && (slots[1] == &storage[1]));
+
+    /* Give them back: same order as freeing one by one. */
+    assert (memPool_freeBulk (&pool, ((uint8_t**) slots), 2U) == MEM_POOL_OK);
+    assert (bitmap[0] == 0U);
+    assert (memPool_freeBulk (&pool, ((uint8_t**) slots), 1U) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+
+    /* Best effort: free list chain first, then bump pointer. */
+    assert (memPool_allocBulk (&pool, ((uint8_t**) slots), (SLOTS + 1U), &got) == MEM_POOL_OK);
+    assert (got == SLOTS);
+    assert ((slots[0] == &storage[1]) && (slots[1] == &storage[0]) && (slots[2] == &storage[2]));
+    assert (slots[SLOTS] == NULL);
+    assert (bitmap[0] == 0x7U);
+
+    assert (memPool_allocBulk (&pool, ((uint8_t**) slots), 1U, &got) == MEM_POOL_ERROR_SPACE);
+    assert (got == 0U);
+
+    /* Invalid slots are skipped, the others freed anyway. */
+    slots[0] = &storage[0];
+    slots[1] = &storage[0];
+    assert (memPool_freeBulk (&pool, ((uint8_t**) slots), 2U) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+    assert (bitmap[0] == 0x6U);
+}
+
+static void
+test_set (void)
+{
+    static const memPoolSet_class_t classes[] = { { 16U, 2U }, { 64U, 1U }, { 256U, 1U } };
+    static const memPoolSet_class_t empty[]   = { { 0U, 4U }, { 16U, 4U } };
+    uint64_t                        storage[((16U * 2U) + 64U + 256U) / sizeof (uint64_t)];
+    memPoolSet_handle_t             set;
+    uint8_t*                        ptrSlot;
+    uint8_t*                        ptrSmall[2];
+
+    /* Subset of classes / not enough storage. */
+    assert (memPoolSet_init (&set, ((uint8_t*) storage), sizeof (storage), &classes[1], 1U) == MEM_POOL_OK);
+    assert (memPoolSet_init (&set, ((uint8_t*) storage), (sizeof (storage) - 1U), classes, 3U) != MEM_POOL_OK);
+    assert (memPoolSet_init (&set, ((uint8_t*) storage), sizeof (storage), empty, 2U) == MEM_POOL_ERROR_PARAMETERS);
+    assert (memPoolSet_init (&set, ((uint8_t*) storage), sizeof (storage), classes, 3U) == MEM_POOL_OK);
+
+    /* Smallest class fitting. */
+    assert (memPoolSet_alloc (&set, 1U, &ptrSmall[0]) == MEM_POOL_OK);
+    assert (ptrSmall[0] == ((uint8_t*) storage));
+    assert (memPoolSet_alloc (&set, 16U, &ptrSmall[1]) == MEM_POOL_OK);
+    assert (ptrSmall[1] == (((uint8_t*) storage) + 16U));
+
+    /* Class exhausted: next larger one. */
+    assert (memPoolSet_alloc (&set, 8U, &ptrSlot) == MEM_POOL_OK);
+    assert (ptrSlot == (((uint8_t*) storage) + 32U));
+    assert (memPoolSet_alloc (&set, 17U, &ptrSlot) == MEM_POOL_OK);
+    assert (ptrSlot == (((uint8_t*) storage) + 96U));
+    assert (memPoolSet_alloc (&set, 17U, &ptrSlot) == MEM_POOL_ERROR_SPACE);
+    assert (ptrSlot == NULL);
+    assert (memPoolSet_alloc (&set, 257U, &ptrSlot) == MEM_POOL_ERROR_PARAMETERS);
+
+    /* Free finds the class from the address. */
+    assert (memPoolSet_free (&set, (((uint8_t*) storage) + 96U)) == MEM_POOL_OK);
+    assert (memPoolSet_free (&set, ptrSmall[1]) == MEM_POOL_OK);
+    assert (memPoolSet_free (&set, ptrSmall[1]) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+    assert (memPoolSet_free (&set, (((uint8_t*) storage) + sizeof (storage))) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+
+    assert (memPoolSet_alloc (&set, 200U, &ptrSlot) == MEM_POOL_OK);
+    assert (ptrSlot == (((uint8_t*) storage) + 96U));
+}
+
+typedef struct
+{
+    uint32_t provided;
+    uint32_t released;
+    uint32_t rejected;
+    bool     small;
+} testGrow_t;
+
+#define TEST_GROW_CHUNK_SIZE 128U
+
+static _Alignas (MEM_POOL_GROW_CHUNK_ALIGN) uint64_t testGrowChunks[2][MEM_POOL_GROW_CHUNK_ALIGN / sizeof (uint64_t)];
+
+static uint8_t*
+test_growProvider (void* ptrContext, uint32_t* ptrSize)
+{
+    testGrow_t* ptrGrow = (testGrow_t*) ptrContext;
+    uint8_t*    ptrChunk;
+
+    ptrChunk = NULL;
+
+    if (ptrGrow->small)
+    {
+        /* Too small to hold a slot. */
+        ptrChunk       = (uint8_t*) testGrowChunks[0];
+        *ptrSize       = 8U;
+        ptrGrow->small = false;
+    }
+    else if (ptrGrow->provided < 2U)
+    {
+        ptrChunk = (uint8_t*) testGrowChunks[ptrGrow->provided];
+        *ptrSize = TEST_GROW_CHUNK_SIZE;
+        ptrGrow->provided++;
+    }
+
+    return ptrChunk;
+}
+
+static void
+test_growRelease (void* ptrContext, uint8_t* ptrChunk, uint32_t size)
+{
+    testGrow_t* ptrGrow = (testGrow_t*) ptrContext;
+
+    assert ((ptrChunk == (uint8_t*) testGrowChunks[0]) || (ptrChunk == (uint8_t*) testGrowChunks[1]));
+
+    if (size == TEST_GROW_CHUNK_SIZE)
+    {
+        ptrGrow->released++;
+    }
+    else
+    {
+        ptrGrow->rejected++;
+    }
+}
+
+static void
+test_grow (void)
+{
+    static _Alignas (MEM_POOL_GROW_CHUNK_ALIGN) uint64_t chunk[16];
+    static _Alignas (MEM_POOL_GROW_CHUNK_ALIGN) uint64_t other[16];
+    memPoolGrow_handle_t                                 pool;
+    memPoolGrow_handle_t                                 otherPool;
+    testGrow_t                                           grow = { 0U, 0U, 0U, true };
+    uint8_t*                                             slots[64];
+    uint32_t                                             number;
+    uint32_t                                             released;
+    uint32_t                                             i;
+
+    /* Manual chunks only (aligned, not larger than alignment). */
+    assert (memPoolGrow_init (&pool, 32U, NULL, NULL, NULL) == MEM_POOL_OK);
+    assert (memPoolGrow_alloc (&pool, &slots[0]) == MEM_POOL_ERROR_SPACE);
+    assert (memPoolGrow_addChunk (&pool, ((uint8_t*) &chunk[1]), (sizeof (chunk) - 8U)) == MEM_POOL_ERROR_PARAMETERS);
+    assert (memPoolGrow_addChunk (&pool, ((uint8_t*) chunk), (MEM_POOL_GROW_CHUNK_ALIGN + 1U)) ==
+            MEM_POOL_ERROR_PARAMETERS);
+    assert (memPoolGrow_addChunk (&pool, ((uint8_t*) chunk), sizeof (chunk)) == MEM_POOL_OK);
+
+    for (number = 0U; memPoolGrow_alloc (&pool, &slots[number]) == MEM_POOL_OK; number++)
+    {
+        assert ((slots[number] > (uint8_t*) chunk) && (slots[number] < (uint8_t*) &chunk[16]));
+    }
+
+    assert (number > 0U);
+
+    /* Only slots handed out (and not freed yet) can be freed. */
+    assert (memPoolGrow_free (&pool, &slots[0][8]) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+    assert (memPoolGrow_free (&pool, ((uint8_t*) &chunk[16])) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+    assert (memPoolGrow_free (&pool, slots[0]) == MEM_POOL_OK);
+    assert (memPoolGrow_free (&pool, slots[0]) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+    assert (memPoolGrow_alloc (&pool, &slots[0]) == MEM_POOL_OK);
+    assert (memPoolGrow_free (&pool, slots[0]) == MEM_POOL_OK);
+
+    assert (memPoolGrow_init (&pool, 32U, NULL, NULL, NULL) == MEM_POOL_OK);
+    assert (memPoolGrow_addChunk (&pool, ((uint8_t*) chunk), sizeof (chunk)) == MEM_POOL_OK);
+    assert (memPoolGrow_alloc (&pool, &slots[0]) == MEM_POOL_OK);
+    assert (memPoolGrow_free (&pool, &slots[0][32]) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+
+    /* Slot of a chunk of another pool. */
+    assert (memPoolGrow_init (&otherPool, 32U, NULL, NULL, NULL) == MEM_POOL_OK);
+    assert (memPoolGrow_addChunk (&otherPool, ((uint8_t*) other), sizeof (other)) == MEM_POOL_OK);
+    assert (memPoolGrow_alloc (&otherPool, &slots[1]) == MEM_POOL_OK);
+    assert (memPoolGrow_free (&pool, slots[1]) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+    assert (memPoolGrow_free (&otherPool, slots[1]) == MEM_POOL_OK);
+
+    /* Chunks from provider, on demand (chunk too small handed back). */
+    assert (memPoolGrow_init (&pool, 32U, test_growProvider, test_growRelease, &grow) == MEM_POOL_OK);
+    assert (memPoolGrow_alloc (&pool, &slots[0]) == MEM_POOL_ERROR_SPACE);
+    assert ((grow.rejected == 1U) && (grow.provided == 0U));
+
+    for (i = 0U; i < number; i++)
+    {
+        assert (memPoolGrow_alloc (&pool, &slots[i]) == MEM_POOL_OK);
+    }
+
+    assert (grow.provided == 1U);
+    assert (memPoolGrow_alloc (&pool, &slots[number]) == MEM_POOL_OK);
+    assert (grow.provided == 2U);
+
+    /* Chunk 1 still has a slot in use: only chunk 0 may be released. */
+    for (i = 0U; i < number; i++)
+    {
+        assert (memPoolGrow_free (&pool, slots[i]) == MEM_POOL_OK);
+    }
+
+    assert (memPoolGrow_shrink (&pool, &released) == MEM_POOL_OK);
+    assert ((released == 1U) && (grow.released == 1U));
+
+    /* Free list holds no slot of the released chunk: chunk 1 bumped next. */
+    assert (memPoolGrow_alloc (&pool, &slots[0]) == MEM_POOL_OK);
+    assert ((slots[0] > (uint8_t*) testGrowChunks[1]) && (slots[0] < (uint8_t*) &testGrowChunks[1][16]));
+
+    assert (memPoolGrow_free (&pool, slots[0]) == MEM_POOL_OK);
+    assert (memPoolGrow_free (&pool, slots[number]) == MEM_POOL_OK);
+    assert (memPoolGrow_shrink (&pool, &released) == MEM_POOL_OK);
+    assert ((released == 1U) && (grow.released == 2U));
+    assert (pool.ptrChunks == NULL);
+    assert (memPoolGrow_alloc (&pool, &slots[0]) == MEM_POOL_ERROR_SPACE);
+}
+
+typedef struct
+{
+    uint32_t owner;
+    uint32_t sequence;
+} testMt_t;
+
+static testMt_t           mtStorage[MT_SLOTS];
+static _Atomic uint32_t   mtBitmap[MEM_POOL_BITMAP_WORDS (MT_SLOTS)];
+static memPoolMt_handle_t mtPool;
+
+static void*
+test_mtWorker (void* ptrArg)
+{
+    uint32_t  owner;
+    uint32_t  i;
+    uint32_t  j;
+    uint32_t  count;
+    testMt_t* slots[MT_BURST];
+
+    owner = (uint32_t) (uintptr_t) ptrArg;
+
+    for (i = 0U; i < MT_ITERATIONS; i++)
+    {
+        /* Allocate a burst (pool may be temporarily exhausted by others). */
+        for (count = 0U; count < (1U + (i % MT_BURST)); count++)
+        {
+            if (memPoolMt_alloc (&mtPool, ((uint8_t**) &slots[count])) != MEM_POOL_OK)
+            {
+                assert (slots[count] == NULL);
+                break;
+            }
+
+            /* Slot must be owned by nobody else. */
+            slots[count]->owner    = owner;
+            slots[count]->sequence = i;
+        }
+
+        for (j = 0U; j < count; j++)
+        {
+            assert (slots[j]->owner    == owner);
+            assert (slots[j]->sequence == i);
+            assert (memPoolMt_free (&mtPool, ((uint8_t*) slots[j])) == MEM_POOL_OK);
+        }
+    }
+
+    return NULL;
+}
+
+static void
+test_mtStress (void)
+{
+    pthread_t       threads[MT_THREADS];
+    uint32_t        i;
+    testMt_t*       ptrSlot;
+    memPool_stats_t stats;
+
+    assert (memPoolMt_init (&mtPool, ((uint8_t*) mtStorage), mtBitmap, 2U, MT_SLOTS) != MEM_POOL_OK);
+    assert (memPoolMt_init (&mtPool, ((uint8_t*) mtStorage), NULL, sizeof(testMt_t), MT_SLOTS) == MEM_POOL_ERROR_PARAMETERS);
+    assert (memPoolMt_init (&mtPool, ((uint8_t*) mtStorage), mtBitmap, sizeof(testMt_t), MT_SLOTS) == MEM_POOL_OK);
+
+    assert (memPoolMt_free (&mtPool, ((uint8_t*) &mtStorage[0])) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+
+    for (i = 0U; i < MT_THREADS; i++)
+    {
+        assert (pthread_create (&threads[i], NULL, test_mtWorker, ((void*) (uintptr_t) (i + 1U))) == 0);
+    }
+
+    for (i = 0U; i < MT_THREADS; i++)
+    {
+        assert (pthread_join (threads[i], NULL) == 0);
+    }
+
+    /* Counters of all threads' shards add up. */
+    assert (memPoolMt_getStats (&mtPool, &stats) == MEM_POOL_OK);
+    assert (stats.inUse == 0U);
+    assert (stats.allocs == stats.frees);
+    assert (stats.freeFailures == 1U);
+    assert (stats.highWater <= MT_SLOTS);
+
+    /* Every slot is back: all can be allocated once, then pool is empty. */
+    for (i = 0U; i < MT_SLOTS; i++)
+    {
+        assert (memPoolMt_alloc (&mtPool, ((uint8_t**) &ptrSlot)) == MEM_POOL_OK);
+    }
+
+    assert (memPoolMt_alloc (&mtPool, ((uint8_t**) &ptrSlot)) == MEM_POOL_ERROR_SPACE);
+    assert (ptrSlot == NULL);
+
+    assert (memPoolMt_free (&mtPool, ((uint8_t*) &mtStorage[0])) == MEM_POOL_OK);
+    assert (memPoolMt_free (&mtPool, ((uint8_t*) &mtStorage[0])) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+}
+
+static void
+test_mtBulk (void)
+{
+    testMt_t*       slots[MT_SLOTS + 1U];
+    memPool_stats_t stats;
+    uint32_t        got;
+
+    assert (memPoolMt_init (&mtPool, ((uint8_t*) mtStorage), mtBitmap, sizeof(testMt_t), MT_SLOTS) == MEM_POOL_OK);
+
+    assert (memPoolMt_allocBulk (&mtPool, ((uint8_t**) slots), 4U, NULL) == MEM_POOL_OK);
+    assert (memPoolMt_freeBulk (&mtPool, ((uint8_t**) slots), 4U) == MEM_POOL_OK);
+    assert (memPoolMt_freeBulk (&mtPool, ((uint8_t**) slots), 4U) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+
+    /* All-or-nothing: slots taken are given back. */
+    assert (memPoolMt_allocBulk (&mtPool, ((uint8_t**) slots), (MT_SLOTS + 1U), NULL) == MEM_POOL_ERROR_SPACE);
+    assert (slots[0] == NULL);
+
+    /* Peak in use: slots given back never counted. */
+    assert (memPoolMt_getStats (&mtPool, &stats) == MEM_POOL_OK);
+    assert ((stats.inUse == 0U) && (stats.highWater == 4U));
+
+    assert (memPoolMt_allocBulk (&mtPool, ((uint8_t**) slots), (MT_SLOTS + 1U), &got) == MEM_POOL_OK);
+    assert (got == MT_SLOTS);
+    assert (slots[MT_SLOTS] == NULL);
+    assert (memPoolMt_freeBulk (&mtPool, ((uint8_t**) slots), MT_SLOTS) == MEM_POOL_OK);
+
+    /* Freed in bulk, allocated in bulk: same chain order as one by one. */
+    assert (memPoolMt_allocBulk (&mtPool, ((uint8_t**) slots), 2U, NULL) == MEM_POOL_OK);
+    assert (slots[0] == &mtStorage[MT_SLOTS - 1U]);
+    assert (slots[1] == &mtStorage[MT_SLOTS - 2U]);
+}
+
+static memPoolQueue_handle_t mtQueue;
+static memPoolQueue_cell_t   mtQueueCells[QUEUE_CELLS];
+static _Atomic uint32_t      mtQueueConsumed;
+static uint32_t              mtQueueExpected;
+
+static void*
+test_queueProducer (void* ptrArg)
+{
+    uint32_t  owner;
+    uint32_t  sent;
+    uint32_t  taken;
+    uint32_t  got;
+    uint32_t  done;
+    uint32_t  i;
+    testMt_t* slots[MT_BURST];
+
+    owner = (uint32_t) (uintptr_t) ptrArg;
+
+    for (sent = 0U; sent < QUEUE_MESSAGES; sent += got)
+    {
+        /* Allocate a batch (best effort), stamp it and enqueue it as room frees up. */
+        (void) memPoolMt_allocBulk (&mtPool, ((uint8_t**) slots), (1U + (sent % MT_BURST)), &taken);
+        got = ((sent + taken) > QUEUE_MESSAGES) ? (QUEUE_MESSAGES - sent) : taken;
+
+        for (i = 0U; i < got; i++)
+        {
+            slots[i]->owner    = owner;
+            slots[i]->sequence = sent + i;
+        }
+
+        for (i = 0U; i < got; i += done)
+        {
+            (void) memPoolQueue_enqueueBulk (&mtQueue, ((uint8_t* const*) &slots[i]), (got - i), &done);
+
+            if (done == 0U)
+            {
+                (void) sched_yield ();
+            }
+        }
+
+        /* Slots left over by the last batch. */
+        if (taken != got)
+        {
+            assert (memPoolMt_freeBulk (&mtPool, ((uint8_t**) &slots[got]), (taken - got)) == MEM_POOL_OK);
+        }
+
+        if (got == 0U)
+        {
+            (void) sched_yield ();
+        }
+    }
+
+    return NULL;
+}
+
+static void*
+test_queueConsumer (void* ptrArg)
+{
+    uint32_t  next[QUEUE_PRODUCERS + 1U];
+    uint32_t  got;
+    uint32_t  i;
+    testMt_t* slots[MT_BURST];
+
+    (void) ptrArg;
+    (void) memset (next, 0x00, sizeof (next));
+
+    while (atomic_load (&mtQueueConsumed) < mtQueueExpected)
+    {
+        (void) memPoolQueue_dequeueBulk (&mtQueue, ((uint8_t**) slots), MT_BURST, &got);
+
+        /* Each producer's slots come out in order. */
+        for (i = 0U; i < got; i++)
+        {
+            assert ((slots[i]->owner != 0U) && (slots[i]->owner <= QUEUE_PRODUCERS));
+            assert (slots[i]->sequence >= next[slots[i]->owner]);
+            next[slots[i]->owner] = slots[i]->sequence + 1U;
+        }
+
+        if (got == 0U)
+        {
+            (void) sched_yield ();
+        }
+        else
+        {
+            assert (memPoolQueue_releaseBulk (&mtQueue, ((uint8_t**) slots), got) == MEM_POOL_OK);
+            (void) atomic_fetch_add (&mtQueueConsumed, got);
+        }
+    }
+
+    return NULL;
+}
+
+static void
+test_queueRun (memPoolQueue_mode_t mode, uint32_t producers)
+{
+    pthread_t threads[2U * QUEUE_PRODUCERS];
+    uint32_t  i;
+    testMt_t* ptrSlot;
+
+    assert (memPoolMt_init (&mtPool, ((uint8_t*) mtStorage), mtBitmap, sizeof(testMt_t), MT_SLOTS) == MEM_POOL_OK);
+    assert (memPoolQueue_init (&mtQueue, &mtPool, mtQueueCells, QUEUE_CELLS, mode) == MEM_POOL_OK);
+
+    atomic_store (&mtQueueConsumed, 0U);
+    mtQueueExpected = producers * QUEUE_MESSAGES;
+
+    for (i = 0U; i < producers; i++)
+    {
+        assert (pthread_create (&threads[i], NULL, test_queueProducer, ((void*) (uintptr_t) (i + 1U))) == 0);
+        assert (pthread_create (&threads[producers + i], NULL, test_queueConsumer, NULL) == 0);
+    }
+
+    for (i = 0U; i < (2U * producers); i++)
+    {
+        assert (pthread_join (threads[i], NULL) == 0);
+    }
+
+    /* All messages consumed, every slot is back. */
+    assert (atomic_load (&mtQueueConsumed) == mtQueueExpected);
+    assert (memPoolQueue_dequeue (&mtQueue, ((uint8_t**) &ptrSlot)) == MEM_POOL_ERROR_SPACE);
+
+    for (i = 0U; i < MT_SLOTS; i++)
+    {
+        assert (memPoolMt_alloc (&mtPool, ((uint8_t**) &ptrSlot)) == MEM_POOL_OK);
+    }
+
+    assert (memPoolMt_alloc (&mtPool, ((uint8_t**) &ptrSlot)) == MEM_POOL_ERROR_SPACE);
+}
+
+static pthread_barrier_t mtQueueBarrier;
+
+static void*
+test_queueContender (void* ptrArg)
+{
+    testMt_t* slots[QUEUE_CELLS / QUEUE_THREADS];
+    uint32_t  round;
+    uint32_t  i;
+
+    (void) ptrArg;
+
+    assert (memPoolMt_allocBulk (&mtPool, ((uint8_t**) slots), (QUEUE_CELLS / QUEUE_THREADS), NULL) == MEM_POOL_OK);
+
+    for (round = 0U; round < QUEUE_ROUNDS; round++)
+    {
+        /* All threads fill the queue together: never full below capacity. */
+        (void) pthread_barrier_wait (&mtQueueBarrier);
+        assert (memPoolQueue_enqueueBulk (&mtQueue, ((uint8_t**) slots), (QUEUE_CELLS / QUEUE_THREADS), NULL) ==
+                MEM_POOL_OK);
+
+        /* Then drain it together: never empty while slots are left. */
+        (void) pthread_barrier_wait (&mtQueueBarrier);
+
+        for (i = 0U; i < (QUEUE_CELLS / QUEUE_THREADS); i++)
+        {
+            assert (memPoolQueue_dequeue (&mtQueue, ((uint8_t**) &slots[i])) == MEM_POOL_OK);
+        }
+    }
+
+    assert (memPoolQueue_releaseBulk (&mtQueue, ((uint8_t**) slots), (QUEUE_CELLS / QUEUE_THREADS)) == MEM_POOL_OK);
+
+    return NULL;
+}
+
+static void
+test_queueContended (void)
+{
+    pthread_t threads[QUEUE_THREADS];
+    uint32_t  i;
+    testMt_t* ptrSlot;
+
+    assert (memPoolMt_init (&mtPool, ((uint8_t*) mtStorage), mtBitmap, sizeof(testMt_t), MT_SLOTS) == MEM_POOL_OK);
+    assert (memPoolQueue_init (&mtQueue, &mtPool, mtQueueCells, QUEUE_CELLS, MEM_POOL_QUEUE_MPMC) == MEM_POOL_OK);
+    assert (pthread_barrier_init (&mtQueueBarrier, NULL, QUEUE_THREADS) == 0);
+
+    for (i = 0U; i < QUEUE_THREADS; i++)
+    {
+        assert (pthread_create (&threads[i], NULL, test_queueContender, NULL) == 0);
+    }
+
+    for (i = 0U; i < QUEUE_THREADS; i++)
+    {
+        assert (pthread_join (threads[i], NULL) == 0);
+    }
+
+    assert (pthread_barrier_destroy (&mtQueueBarrier) == 0);
+    assert (memPoolQueue_dequeue (&mtQueue, ((uint8_t**) &ptrSlot)) == MEM_POOL_ERROR_SPACE);
+}
+
+static void
+test_queue (void)
+{
+    testMt_t* slots[QUEUE_CELLS + 1U];
+    testMt_t* sent[QUEUE_CELLS + 1U];
+    testMt_t* ptrSlot;
+    uint32_t  mode;
+    uint32_t  i;
+    uint32_t  done;
+    testMt_t  other;
+
+    assert (memPoolMt_init (&mtPool, ((uint8_t*) mtStorage), mtBitmap, sizeof(testMt_t), MT_SLOTS) == MEM_POOL_OK);
+    assert (memPoolQueue_init (&mtQueue, &mtPool, mtQueueCells, 12U, MEM_POOL_QUEUE_SPSC) ==
+            MEM_POOL_ERROR_PARAMETERS);
+
+    for (mode = MEM_POOL_QUEUE_SPSC; mode <= MEM_POOL_QUEUE_MPMC; mode++)
+    {
+        assert (memPoolQueue_init (&mtQueue, &mtPool, mtQueueCells, QUEUE_CELLS, (memPoolQueue_mode_t) mode) ==
+                MEM_POOL_OK);
+        assert (memPoolMt_allocBulk (&mtPool, ((uint8_t**) slots), (QUEUE_CELLS + 1U), NULL) == MEM_POOL_OK);
+        (void) memcpy (sent, slots, sizeof (sent));
+
+        /* Only slots of the pool are carried. */
+        assert (memPoolQueue_enqueue (&mtQueue, ((uint8_t*) &other)) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+        assert (memPoolQueue_enqueue (&mtQueue, (((uint8_t*) slots[0]) + 1U)) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+
+        /* Full: all-or-nothing batch fails, best effort one fills what fits. */
+        assert (memPoolQueue_enqueue (&mtQueue, ((uint8_t*) slots[0])) == MEM_POOL_OK);
+        assert (memPoolQueue_enqueueBulk (&mtQueue, ((uint8_t**) &slots[1]), QUEUE_CELLS, NULL) ==
+                MEM_POOL_ERROR_SPACE);
+        assert (memPoolQueue_enqueueBulk (&mtQueue, ((uint8_t**) &slots[1]), QUEUE_CELLS, &done) == MEM_POOL_OK);
+        assert (done == (QUEUE_CELLS - 1U));
+        assert (memPoolQueue_enqueue (&mtQueue, ((uint8_t*) slots[QUEUE_CELLS])) == MEM_POOL_ERROR_SPACE);
+
+        /* FIFO order, batch wraps around the ring. */
+        assert (memPoolQueue_dequeue (&mtQueue, ((uint8_t**) &ptrSlot)) == MEM_POOL_OK);
+        assert (ptrSlot == slots[0]);
+        assert (memPoolQueue_enqueue (&mtQueue, ((uint8_t*) slots[QUEUE_CELLS])) == MEM_POOL_OK);
+        assert (memPoolQueue_dequeueBulk (&mtQueue, ((uint8_t**) slots), (QUEUE_CELLS + 1U), NULL) ==
+                MEM_POOL_ERROR_SPACE);
+        assert (slots[0] == NULL);
+        assert (memPoolQueue_dequeueBulk (&mtQueue, ((uint8_t**) slots), (QUEUE_CELLS + 1U), &done) == MEM_POOL_OK);
+        assert ((done == QUEUE_CELLS) && (slots[QUEUE_CELLS] == NULL));
+
+        for (i = 0U; i < QUEUE_CELLS; i++)
+        {
+            assert (slots[i] == sent[i + 1U]);
+        }
+
+        /* Consumer releases to the originating pool. */
+        assert (memPoolQueue_releaseBulk (&mtQueue, ((uint8_t**) slots), QUEUE_CELLS) == MEM_POOL_OK);
+        assert (memPoolQueue_release (&mtQueue, ((uint8_t*) ptrSlot)) == MEM_POOL_OK);
+        assert (memPoolQueue_release (&mtQueue, ((uint8_t*) ptrSlot)) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+        assert (memPoolQueue_dequeue (&mtQueue, ((uint8_t**) &ptrSlot)) == MEM_POOL_ERROR_SPACE);
+    }
+
+    test_queueRun (MEM_POOL_QUEUE_SPSC, 1U);
+    test_queueRun (MEM_POOL_QUEUE_MPMC, QUEUE_PRODUCERS);
+    test_queueContended ();
+}
+
+static _Thread_local memPoolMag_t mtMagazine;
+
+static void*
+test_magWorker (void* ptrArg)
+{
+    uint32_t  owner;
+    uint32_t  i;
+    uint32_t  count;
+    testMt_t* slots[MT_BURST];
+
+    owner = (uint32_t) (uintptr_t) ptrArg;
+
+    assert (memPoolMag_init (&mtMagazine, &mtPool) == MEM_POOL_OK);
+
+    for (i = 0U; i < MT_ITERATIONS; i++)
+    {
+        for (count = 0U; count < (1U + (i % MT_BURST)); count++)
+        {
+            if (memPoolMag_alloc (&mtMagazine, ((uint8_t**) &slots[count])) != MEM_POOL_OK)
+            {
+                break;
+            }
+
+            slots[count]->owner    = owner;
+            slots[count]->sequence = i;
+        }
+
+        while (count > 0U)
+        {
+            count--;
+            assert (slots[count]->owner    == owner);
+            assert (slots[count]->sequence == i);
+            assert (memPoolMag_free (&mtMagazine, ((uint8_t*) slots[count])) == MEM_POOL_OK);
+        }
+    }
+
+    /* Exit with cached slots: they go back to pool on thread exit. */
+    return NULL;
+}
+
+static void
+test_magazine (void)
+{
+    pthread_t    threads[MT_THREADS];
+    memPoolMag_t magazine;
+    uint32_t     i;
+    testMt_t*    ptrSlot;
+
+    assert (memPoolMt_init (&mtPool, ((uint8_t*) mtStorage), mtBitmap, sizeof(testMt_t), MT_SLOTS) == MEM_POOL_OK);
+
+    /* Single thread: refill, flush & deinit. */
+    assert (memPoolMag_init (&magazine, &mtPool) == MEM_POOL_OK);
+
+    for (i = 0U; i < MT_SLOTS; i++)
+    {
+        assert (memPoolMag_alloc (&magazine, ((uint8_t**) &ptrSlot)) == MEM_POOL_OK);
+    }
+
+    assert (memPoolMag_alloc (&magazine, ((uint8_t**) &ptrSlot)) == MEM_POOL_ERROR_SPACE);
+
+    for (i = 0U; i < MT_SLOTS; i++)
+    {
+        assert (memPoolMag_free (&magazine, ((uint8_t*) &mtStorage[i])) == MEM_POOL_OK);
+        assert (magazine.count <= MEM_POOL_MAGAZINE_SIZE);
+    }
+
+    /* Recycled slot is handed out zeroised. */
+    assert (memPoolMag_alloc (&magazine, ((uint8_t**) &ptrSlot)) == MEM_POOL_OK);
+    (void) memset (ptrSlot, 0xAB, sizeof(testMt_t));
+    assert (memPoolMag_free (&magazine, ((uint8_t*) ptrSlot)) == MEM_POOL_OK);
+    assert (memPoolMag_alloc (&magazine, ((uint8_t**) &ptrSlot)) == MEM_POOL_OK);
+
+    for (i = 0U; i < sizeof(testMt_t); i++)
+    {
+        assert (((uint8_t*) ptrSlot)[i] == 0x00U);
+    }
+
+    assert (memPoolMag_free (&magazine, ((uint8_t*) ptrSlot)) == MEM_POOL_OK);
+
+    /* Double free of a cached slot, slot not on a boundary or outside pool. */
+    assert (memPoolMag_free (&magazine, ((uint8_t*) ptrSlot)) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+    assert (memPoolMag_alloc (&magazine, ((uint8_t**) &ptrSlot)) == MEM_POOL_OK);
+    assert (memPoolMag_free (&magazine, (((uint8_t*) ptrSlot) + 4U)) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+    assert (memPoolMag_free (&magazine, ((uint8_t*) &mtStorage[MT_SLOTS])) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+    assert (memPoolMag_free (&magazine, ((uint8_t*) ptrSlot)) == MEM_POOL_OK);
+
+    assert (memPoolMag_deinit (&magazine) == MEM_POOL_OK);
+    assert (magazine.count == 0U);
+
+    for (i = 0U; i < MT_THREADS; i++)
+    {
+        assert (pthread_create (&threads[i], NULL, test_magWorker, ((void*) (uintptr_t) (i + 1U))) == 0);
+    }
+
+    for (i = 0U; i < MT_THREADS; i++)
+    {
+        assert (pthread_join (threads[i], NULL) == 0);
+    }
+
+    /* Every slot is back in the shared pool. */
+    for (i = 0U; i < MT_SLOTS; i++)
+    {
+        assert (memPoolMt_alloc (&mtPool, ((uint8_t**) &ptrSlot)) == MEM_POOL_OK);
+    }
+
+    assert (memPoolMt_alloc (&mtPool, ((uint8_t**) &ptrSlot)) == MEM_POOL_ERROR_SPACE);
+}
+
+static void
+test_zeroPolicy (void)
+{
+    uint8_t          storage[4U * 128U] __attribute__ ((aligned (16)));
+    memPool_handle_t pool;
+    uint32_t         i;
+    uint32_t         cleared;
+    uint8_t*         ptrSlot;
+    uint8_t*         ptrOther;
+    bool             zeroed;
+
+    /* Clear on alloc (default). */
+    (void) memset (storage, 0xAA, sizeof (storage));
+    assert (memPool_init (&pool, storage, 128U, 4U) == MEM_POOL_OK);
+    assert (memPool_allocZeroed (&pool, &ptrSlot, &zeroed) == MEM_POOL_OK);
+    assert ((zeroed == true) && (ptrSlot[127] == 0x00U));
+    (void) memset (ptrSlot, 0xAA, 128U);
+    assert (memPool_free (&pool, ptrSlot) == MEM_POOL_OK);
+    assert (memPool_allocZeroed (&pool, &ptrSlot, &zeroed) == MEM_POOL_OK);
+    assert ((zeroed == true) && (ptrSlot[127] == 0x00U));
+
+    /* Policy set before first allocation only. */
+    assert (memPool_setZeroPolicy (&pool, MEM_POOL_ZERO_ON_FREE, 0U) == MEM_POOL_ERROR_PARAMETERS);
+
+    /* Clear on free. */
+    assert (memPool_init (&pool, storage, 128U, 4U) == MEM_POOL_OK);
+    assert (memPool_setZeroPolicy (&pool, MEM_POOL_ZERO_ON_FREE, 0U) == MEM_POOL_OK);
+    assert (memPool_allocZeroed (&pool, &ptrSlot, &zeroed) == MEM_POOL_OK);
+    assert ((zeroed == true) && (ptrSlot[127] == 0x00U));
+    (void) memset (ptrSlot, 0xAA, 128U);
+    assert (memPool_free (&pool, ptrSlot) == MEM_POOL_OK);
+    assert (ptrSlot[127] == 0x00U);
+    assert (memPool_allocZeroed (&pool, &ptrSlot, &zeroed) == MEM_POOL_OK);
+    assert ((zeroed == true) && (*((uint8_t**) ptrSlot) == NULL));
+
+    /* Clear first bytes only. */
+    (void) memset (storage, 0xAA, sizeof (storage));
+    assert (memPool_init (&pool, storage, 128U, 4U) == MEM_POOL_OK);
+    assert (memPool_setZeroPolicy (&pool, MEM_POOL_ZERO_PARTIAL, 16U) == MEM_POOL_OK);
+    assert (memPool_allocZeroed (&pool, &ptrSlot, &zeroed) == MEM_POOL_OK);
+    assert ((zeroed == false) && (ptrSlot[15] == 0x00U) && (ptrSlot[16] == 0xAAU));
+
+    /* Deferred: freed slots handed out as is until cleared. */
+    (void) memset (storage, 0xAA, sizeof (storage));
+    assert (memPool_init (&pool, storage, 128U, 4U) == MEM_POOL_OK);
+    assert (memPool_setZeroPolicy (&pool, MEM_POOL_ZERO_DEFERRED, 0U) == MEM_POOL_OK);
+    assert (memPool_allocZeroed (&pool, &ptrSlot, &zeroed) == MEM_POOL_OK);
+    assert ((zeroed == true) && (ptrSlot[127] == 0x00U));
+    assert (memPool_alloc (&pool, &ptrOther) == MEM_POOL_OK);
+    (void) memset (ptrSlot, 0xAA, 128U);
+    (void) memset (ptrOther, 0xAA, 128U);
+    assert (memPool_free (&pool, ptrSlot) == MEM_POOL_OK);
+    assert (memPool_free (&pool, ptrSlot) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+    assert (memPool_allocZeroed (&pool, &ptrSlot, &zeroed) == MEM_POOL_OK);
+    assert ((zeroed == false) && (ptrSlot[127] == 0xAAU));
+
+    assert (memPool_free (&pool, ptrSlot) == MEM_POOL_OK);
+    assert (memPool_free (&pool, ptrOther) == MEM_POOL_OK);
+    assert (memPool_zeroDirty (&pool, 1U, &cleared) == MEM_POOL_OK);
+    assert (cleared == 1U);
+    assert (memPool_zeroDirty (&pool, 8U, &cleared) == MEM_POOL_OK);
+    assert (cleared == 1U);
+    assert (memPool_zeroDirty (&pool, 8U, &cleared) == MEM_POOL_OK);
+    assert (cleared == 0U);
+
+    for (i = 0U; i < 2U; i++)
+    {
+        assert (memPool_allocZeroed (&pool, &ptrSlot, &zeroed) == MEM_POOL_OK);
+        assert ((zeroed == true) && (*((uint8_t**) ptrSlot) == NULL) && (ptrSlot[64] == 0x00U) && (ptrSlot[127] == 0x00U));
+    }
+}
+
+typedef struct
+{
+    uint32_t constructed;
+    uint32_t reset;
+    uint32_t destructed;
+} testObj_t;
+
+typedef struct
+{
+    uint32_t magic;
+    uint32_t uses;
+    uint8_t  buffer[20];
+} testObject_t;
+
+static void
+test_objConstruct (void* ptrContext, uint8_t* ptrObject)
+{
+    testObject_t* ptrObj = (testObject_t*) ptrObject;
+
+    ((testObj_t*) ptrContext)->constructed++;
+    ptrObj->magic = 0xC0FFEEU;
+    ptrObj->uses  = 0U;
+    (void) memset (ptrObj->buffer, 0x5A, sizeof (ptrObj->buffer));
+}
+
+static void
+test_objReset (void* ptrContext, uint8_t* ptrObject)
+{
+    ((testObj_t*) ptrContext)->reset++;
+    ((testObject_t*) ptrObject)->uses++;
+}
+
+static void
+test_objDestruct (void* ptrContext, uint8_t* ptrObject)
+{
+    ((testObj_t*) ptrContext)->destructed++;
+    assert (((testObject_t*) ptrObject)->magic == 0xC0FFEEU);
+}
+
+static void
+test_obj (void)
+{
+    static uint64_t     storage[(4U * MEM_POOL_OBJ_SLOT_SIZE (sizeof (testObject_t))) / sizeof (uint64_t)];
+    uint32_t            bitmap[MEM_POOL_BITMAP_WORDS (4U)];
+    memPoolObj_handle_t pool;
+    testObj_t           hooks = { 0U, 0U, 0U };
+    testObject_t*       ptrObjects[4];
+    testObject_t*       ptrObject;
+    uint32_t            i;
+
+    assert (MEM_POOL_OBJ_SLOT_SIZE (sizeof (testObject_t)) == (sizeof (uint8_t*) + 32U));
+    assert (memPoolObj_init (&pool, ((uint8_t*) storage), bitmap, sizeof (testObject_t), 4U,
+                             test_objConstruct, test_objReset, test_objDestruct, &hooks) == MEM_POOL_OK);
+
+    /* Constructed once, when first handed out. */
+    for (i = 0U; i < 4U; i++)
+    {
+        assert (memPoolObj_alloc (&pool, ((uint8_t**) &ptrObjects[i])) == MEM_POOL_OK);
+        assert ((ptrObjects[i]->magic == 0xC0FFEEU) && (((uintptr_t) ptrObjects[i] % sizeof (uint8_t*)) == 0U));
+    }
+
+    assert (memPoolObj_alloc (&pool, ((uint8_t**) &ptrObject)) == MEM_POOL_ERROR_SPACE);
+    assert (hooks.constructed == 4U);
+
+    /* Warm reuse: object untouched by the pool (reset only). */
+    assert (memPoolObj_free (&pool, ((uint8_t*) ptrObjects[2])) == MEM_POOL_OK);
+    assert (memPoolObj_free (&pool, ((uint8_t*) ptrObjects[2])) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+    assert (hooks.reset == 1U);
+    assert (memPoolObj_alloc (&pool, ((uint8_t**) &ptrObject)) == MEM_POOL_OK);
+    assert (ptrObject == ptrObjects[2]);
+    assert ((ptrObject->magic == 0xC0FFEEU) && (ptrObject->uses == 1U) && (ptrObject->buffer[0] == 0x5AU));
+    assert (hooks.constructed == 4U);
+
+    for (i = 0U; i < 4U; i++)
+    {
+        assert (memPoolObj_free (&pool, ((uint8_t*) ptrObjects[i])) == MEM_POOL_OK);
+    }
+
+    assert (memPoolObj_deinit (&pool) == MEM_POOL_OK);
+    assert (hooks.destructed == 4U);
+    assert (memPoolObj_alloc (&pool, ((uint8_t**) &ptrObject)) == MEM_POOL_ERROR_SPACE);
+
+    /* No hooks. */
+    assert (memPoolObj_init (&pool, ((uint8_t*) storage), NULL, sizeof (testObject_t), 4U,
+                             NULL, NULL, NULL, NULL) == MEM_POOL_OK);
+    assert (memPoolObj_alloc (&pool, ((uint8_t**) &ptrObject)) == MEM_POOL_OK);
+    assert (memPoolObj_free (&pool, ((uint8_t*) ptrObject)) == MEM_POOL_OK);
+    assert (memPoolObj_deinit (&pool) == MEM_POOL_OK);
+}
+
+static void
+test_index (void)
+{
+    uint32_t         storage[8];
+    uint32_t         bitmap[MEM_POOL_BITMAP_WORDS (8U)];
+    memPool_index_t  index[8];
+    memPool_handle_t pool;
+    uint32_t*        ptrSlots[16];
+    uint32_t*        ptrSlot;
+    uint32_t         got;
+    uint32_t         i;
+
+    /* 4-byte slots (smaller than a pointer), 16-bit indices: 65536 slots at most. */
+    assert (sizeof (memPool_index_t) == 2U);
+    assert (memPool_initIndex (&pool, ((uint8_t*) storage), NULL, index, sizeof (uint32_t), 65537U) != MEM_POOL_OK);
+    assert (memPool_initIndex (&pool, ((uint8_t*) storage), NULL, NULL, sizeof (uint32_t), 8U) != MEM_POOL_OK);
+    assert (memPool_initIndex (&pool, ((uint8_t*) storage), NULL, index, sizeof (uint32_t), 8U) == MEM_POOL_OK);
+    assert (memPool_setZeroPolicy (&pool, MEM_POOL_ZERO_DEFERRED, 0U) != MEM_POOL_OK);
+
+    for (i = 0U; i < 8U; i++)
+    {
+        assert (memPool_alloc (&pool, ((uint8_t**) &ptrSlots[i])) == MEM_POOL_OK);
+        assert ((ptrSlots[i] == &storage[i]) && (*ptrSlots[i] == 0U));
+        *ptrSlots[i] = 0xDEADBEEFU;
+    }
+
+    assert (memPool_alloc (&pool, ((uint8_t**) &ptrSlot)) == MEM_POOL_ERROR_SPACE);
+
+    /* Freed slots are not written (LIFO reuse). */
+    assert (memPool_free (&pool, ((uint8_t*) ptrSlots[3])) == MEM_POOL_OK);
+    assert (memPool_free (&pool, ((uint8_t*) ptrSlots[5])) == MEM_POOL_OK);
+    assert ((storage[3] == 0xDEADBEEFU) && (storage[5] == 0xDEADBEEFU) && (index[1] == 5U));
+
+    /* Double free (legacy walk of the index stack). */
+    assert (memPool_free (&pool, ((uint8_t*) ptrSlots[3])) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+
+    assert (memPool_alloc (&pool, ((uint8_t**) &ptrSlot)) == MEM_POOL_OK);
+    assert ((ptrSlot == &storage[5]) && (*ptrSlot == 0U));
+
+    /* Bitmap & bulk. */
+    assert (memPool_initIndex (&pool, ((uint8_t*) storage), bitmap, index, sizeof (uint32_t), 8U) == MEM_POOL_OK);
+    assert (memPool_allocBulk (&pool, ((uint8_t**) ptrSlots), 8U, NULL) == MEM_POOL_OK);
+    assert (memPool_freeBulk (&pool, ((uint8_t* const*) ptrSlots), 8U) == MEM_POOL_OK);
+    assert (memPool_free (&pool, ((uint8_t*) ptrSlots[0])) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+    assert (memPool_allocBulk (&pool, ((uint8_t**) ptrSlots), 16U, &got) == MEM_POOL_OK);
+    assert ((got == 8U) && (ptrSlots[0] == &storage[7]) && (ptrSlots[7] == &storage[0]));
+}
+
+static void
+test_handle (void)
+{
+    test_t               storage[4];
+    uint32_t             bitmap[MEM_POOL_BITMAP_WORDS (4U)];
+    uint32_t             gen[4];
+    memPool_handle_t     pool;
+    memPool_slotHandle_t handles[4];
+    memPool_slotHandle_t handle;
+    uint8_t*             ptrSlot;
+    uint32_t             i;
+
+    assert (sizeof (memPool_slotHandle_t) == 4U);
+
+    /* Generations enabled before first allocation only. */
+    assert (memPool_init (&pool, ((uint8_t*) storage), sizeof (test_t), 4U) == MEM_POOL_OK);
+    assert (memPool_allocHandle (&pool, &handle, NULL) == MEM_POOL_ERROR_PARAMETERS);
+    assert (memPool_setGenerations (&pool, gen) == MEM_POOL_OK);
+
+    for (i = 0U; i < 4U; i++)
+    {
+        assert (memPool_allocHandle (&pool, &handles[i], &ptrSlot) == MEM_POOL_OK);
+        assert ((handles[i] != MEM_POOL_SLOT_HANDLE_NULL) && (ptrSlot == ((uint8_t*) &storage[i])));
+        assert (memPool_resolve (&pool, handles[i], &ptrSlot) == MEM_POOL_OK);
+        assert (ptrSlot == ((uint8_t*) &storage[i]));
+    }
+
+    assert (memPool_allocHandle (&pool, &handle, &ptrSlot) == MEM_POOL_ERROR_SPACE);
+    assert ((handle == MEM_POOL_SLOT_HANDLE_NULL) && (ptrSlot == NULL));
+    assert (memPool_setGenerations (&pool, gen) == MEM_POOL_ERROR_PARAMETERS);
+
+    /* Stale handle: slot freed (through pointer or handle) and reused. */
+    assert (memPool_free (&pool, ((uint8_t*) &storage[1])) == MEM_POOL_OK);
+    assert (memPool_resolve (&pool, handles[1], &ptrSlot) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+    assert (ptrSlot == NULL);
+    assert (memPool_allocHandle (&pool, &handle, &ptrSlot) == MEM_POOL_OK);
+    assert ((ptrSlot == ((uint8_t*) &storage[1])) && (handle != handles[1]));
+    assert (memPool_resolve (&pool, handles[1], &ptrSlot) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+    assert (memPool_freeHandle (&pool, handles[1]) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+    assert (memPool_freeHandle (&pool, handle) == MEM_POOL_OK);
+    assert (memPool_freeHandle (&pool, handle) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+
+    /* Invalid handles. */
+    assert (memPool_resolve (&pool, MEM_POOL_SLOT_HANDLE_NULL, &ptrSlot) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+    assert (memPool_resolve (&pool, ((handles[0] & ~0xFFFFU) | 7U), &ptrSlot) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+
+    /* With bitmap: freed slot is rejected even with a forged generation. */
+    assert (memPool_initBitmap (&pool, ((uint8_t*) storage), bitmap, sizeof (test_t), 4U) == MEM_POOL_OK);
+    assert (memPool_setGenerations (&pool, gen) == MEM_POOL_OK);
+    assert (memPool_allocHandle (&pool, &handle, NULL) == MEM_POOL_OK);
+    assert (memPool_freeHandle (&pool, handle) == MEM_POOL_OK);
+    assert (memPool_resolve (&pool, (handle + 0x10000U), &ptrSlot) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+
+    /* Enabled after a reset: generations of slots handed out before are cleared. */
+    assert (memPool_init (&pool, ((uint8_t*) storage), sizeof (test_t), 4U) == MEM_POOL_OK);
+    assert (memPool_alloc (&pool, &ptrSlot) == MEM_POOL_OK);
+    assert (memPool_reset (&pool) == MEM_POOL_OK);
+    (void) memset (gen, 0x55, sizeof (gen));
+    assert (memPool_setGenerations (&pool, gen) == MEM_POOL_OK);
+    assert (memPool_allocHandle (&pool, &handle, &ptrSlot) == MEM_POOL_OK);
+    assert ((ptrSlot == ((uint8_t*) &storage[0])) && (handle == 0x10000U));
+}
+
+static memPoolRemote_handle_t remotePool;
+static testMt_t               remoteStorage[MT_SLOTS];
+static uint32_t               remoteBitmap[MEM_POOL_BITMAP_WORDS (MT_SLOTS)];
+static _Atomic (testMt_t*)    remoteMailbox[MT_THREADS];
+
+static void*
+test_remoteWorker (void* ptrArg)
+{
+    uint32_t  id = (uint32_t) (uintptr_t) ptrArg;
+    uint32_t  i;
+    testMt_t* ptrSlot;
+
+    /* Consume slots produced by the owner, free them remotely. */
+    for (i = 0U; i < MT_ITERATIONS; i++)
+    {
+        while ((ptrSlot = atomic_exchange (&remoteMailbox[id], NULL)) == NULL)
+        {
+            (void) sched_yield ();
+        }
+
+        assert (ptrSlot->owner == (id + 1U));
+        assert (memPoolRemote_freeRemote (&remotePool, ((uint8_t*) ptrSlot)) == MEM_POOL_OK);
+    }
+
+    return NULL;
+}
+
+static void
+test_remote (void)
+{
+    pthread_t threads[MT_THREADS];
+    uint32_t  i;
+    uint32_t  t;
+    uint32_t  drained;
+    testMt_t* ptrSlot;
+    testMt_t* ptrSlots[MT_SLOTS];
+
+    assert (memPoolRemote_init (&remotePool, ((uint8_t*) remoteStorage), remoteBitmap, sizeof (testMt_t), MT_SLOTS) ==
+            MEM_POOL_OK);
+
+    /* Owner only: plain pool. */
+    assert (memPoolRemote_alloc (&remotePool, ((uint8_t**) &ptrSlot)) == MEM_POOL_OK);
+    assert (memPoolRemote_free (&remotePool, ((uint8_t*) ptrSlot)) == MEM_POOL_OK);
+    assert (memPoolRemote_freeRemote (&remotePool, ((uint8_t*) &remoteStorage[MT_SLOTS])) != MEM_POOL_OK);
+    assert (memPoolRemote_freeRemote (&remotePool, (((uint8_t*) &remoteStorage[0]) + 4U)) ==
+            MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+
+    /* Remote frees are taken back on alloc miss. */
+    for (i = 0U; i < MT_SLOTS; i++)
+    {
+        assert (memPoolRemote_alloc (&remotePool, ((uint8_t**) &ptrSlots[i])) == MEM_POOL_OK);
+    }
+
+    assert (memPoolRemote_freeRemote (&remotePool, ((uint8_t*) ptrSlots[3])) == MEM_POOL_OK);
+    assert (memPoolRemote_freeRemote (&remotePool, ((uint8_t*) ptrSlots[7])) == MEM_POOL_OK);
+    assert (memPoolRemote_alloc (&remotePool, ((uint8_t**) &ptrSlot)) == MEM_POOL_OK);
+    assert ((ptrSlot == ptrSlots[3]) || (ptrSlot == ptrSlots[7]));
+    assert (memPoolRemote_alloc (&remotePool, ((uint8_t**) &ptrSlot)) == MEM_POOL_OK);
+    assert (memPoolRemote_alloc (&remotePool, ((uint8_t**) &ptrSlot)) == MEM_POOL_ERROR_SPACE);
+
+    /* Double remote free detected when draining. */
+    assert (memPoolRemote_free (&remotePool, ((uint8_t*) ptrSlots[0])) == MEM_POOL_OK);
+    assert (memPoolRemote_freeRemote (&remotePool, ((uint8_t*) ptrSlots[0])) == MEM_POOL_OK);
+    assert (memPoolRemote_drain (&remotePool, &drained) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+    assert (drained == 0U);
+
+    for (i = 1U; i < MT_SLOTS; i++)
+    {
+        assert (memPoolRemote_free (&remotePool, ((uint8_t*) ptrSlots[i])) == MEM_POOL_OK);
+    }
+
+    /* Producer (owner) / consumers (remote free). */
+    for (t = 0U; t < MT_THREADS; t++)
+    {
+        atomic_init (&remoteMailbox[t], NULL);
+        assert (pthread_create (&threads[t], NULL, test_remoteWorker, ((void*) (uintptr_t) t)) == 0);
+    }
+
+    for (i = 0U; i < MT_ITERATIONS; i++)
+    {
+        for (t = 0U; t < MT_THREADS; t++)
+        {
+            /* Wait for the consumer to take previous slot, pool may be empty meanwhile. */
+            while (atomic_load (&remoteMailbox[t]) != NULL)
+            {
+                (void) sched_yield ();
+            }
+
+            while (memPoolRemote_alloc (&remotePool, ((uint8_t**) &ptrSlot)) != MEM_POOL_OK)
+            {
+                (void) sched_yield ();
+            }
+
+            ptrSlot->owner = t + 1U;
+            atomic_store (&remoteMailbox[t], ptrSlot);
+        }
+    }
+
+    for (t = 0U; t < MT_THREADS; t++)
+    {
+        assert (pthread_join (threads[t], NULL) == 0);
+    }
+
+    /* Every slot is back. */
+    assert (memPoolRemote_drain (&remotePool, NULL) == MEM_POOL_OK);
+
+    for (i = 0U; i < MT_SLOTS; i++)
+    {
+        assert (memPoolRemote_alloc (&remotePool, ((uint8_t**) &ptrSlot)) == MEM_POOL_OK);
+    }
+
+    assert (memPoolRemote_alloc (&remotePool, ((uint8_t**) &ptrSlot)) == MEM_POOL_ERROR_SPACE);
+}
+
+static void
+test_debug (void)
+{
+    uint64_t         storage[4U * 4U];
+    memPool_handle_t pool;
+    uint8_t*         ptrSlots[4];
+    uint8_t*         ptrSlot;
+    uint32_t         got;
+
+    /* O(1) range checks, even with no bitmap: outside pool, not on a slot boundary. */
+    assert (memPool_init (&pool, ((uint8_t*) storage), 32U, 4U) == MEM_POOL_OK);
+    assert (memPool_alloc (&pool, &ptrSlot) == MEM_POOL_OK);
+    assert (memPool_free (&pool, &ptrSlot[8]) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+    assert (memPool_free (&pool, ((uint8_t*) &storage[16])) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+    assert (memPool_free (&pool, ptrSlot) == MEM_POOL_OK);
+
+    /* Before first allocation only, canary must fit after the link word. */
+    assert (memPool_setDebug (&pool, MEM_POOL_DEBUG_POISON) != MEM_POOL_OK);
+    assert (memPool_init (&pool, ((uint8_t*) storage), 15U, 4U) == MEM_POOL_OK);
+    assert (memPool_setDebug (&pool, MEM_POOL_DEBUG_CANARY) != MEM_POOL_OK);
+    assert (memPool_init (&pool, ((uint8_t*) storage), 32U, 4U) == MEM_POOL_OK);
+    assert (memPool_setDebug (&pool, 0x80U) != MEM_POOL_OK);
+    assert (memPool_setDebug (&pool, (MEM_POOL_DEBUG_POISON | MEM_POOL_DEBUG_CANARY)) == MEM_POOL_OK);
+
+    assert (memPool_alloc (&pool, &ptrSlots[0]) == MEM_POOL_OK);
+    assert (memPool_alloc (&pool, &ptrSlots[1]) == MEM_POOL_OK);
+    assert ((ptrSlots[1][24] == 0xCBU) && (ptrSlots[1][31] == 0xCBU));
+
+    /* Freed slot poisoned (but the link word). */
+    assert (memPool_free (&pool, ptrSlots[0]) == MEM_POOL_OK);
+    assert ((ptrSlots[0][8] == 0xDDU) && (ptrSlots[0][31] == 0xDDU));
+
+    /* Use after free: slot quarantined. */
+    ptrSlots[0][20] = 0x00U;
+    assert (memPool_alloc (&pool, &ptrSlot) == MEM_POOL_ERROR_CORRUPTED);
+    assert ((ptrSlot == NULL) && (pool.corruptions == 1U));
+    assert (memPool_alloc (&pool, &ptrSlot) == MEM_POOL_OK);
+    assert (ptrSlot == ((uint8_t*) &storage[8]));
+
+    /* Overflow into the canary: slot quarantined (stays allocated). */
+    ptrSlots[1][24] = 0x00U;
+    assert (memPool_free (&pool, ptrSlots[1]) == MEM_POOL_ERROR_CORRUPTED);
+    assert (pool.corruptions == 2U);
+    assert (memPool_free (&pool, ptrSlot) == MEM_POOL_OK);
+
+    /* Bulk: quarantined slots skipped. */
+    assert (memPool_allocBulk (&pool, ptrSlots, 4U, &got) == MEM_POOL_OK);
+    assert ((got == 2U) && (ptrSlots[0] == ((uint8_t*) &storage[8])) && (ptrSlots[2] == NULL));
+
+    /* Bulk all-or-nothing failure: slot written after free only counted once committed. */
+    assert (memPool_init (&pool, ((uint8_t*) storage), 32U, 4U) == MEM_POOL_OK);
+    assert (memPool_setDebug (&pool, (MEM_POOL_DEBUG_POISON | MEM_POOL_DEBUG_CANARY)) == MEM_POOL_OK);
+    assert (memPool_allocBulk (&pool, ptrSlots, 2U, NULL) == MEM_POOL_OK);
+    assert (memPool_free (&pool, ptrSlots[0]) == MEM_POOL_OK);
+    ptrSlots[0][20] = 0x00U;
+    assert (memPool_allocBulk (&pool, ptrSlots, 3U, NULL) == MEM_POOL_ERROR_SPACE);
+    assert (pool.corruptions == 0U);
+    assert (memPool_allocBulk (&pool, ptrSlots, 1U, NULL) == MEM_POOL_OK);
+    assert ((pool.corruptions == 1U) && (ptrSlots[0] == ((uint8_t*) &storage[8])));
+
+    /* Bulk free: overflow reported as such. */
+    ptrSlots[1]     = (uint8_t*) &storage[4];
+    ptrSlots[1][24] = 0x00U;
+    assert (memPool_freeBulk (&pool, ptrSlots, 2U) == MEM_POOL_ERROR_CORRUPTED);
+    assert (pool.corruptions == 2U);
+
+    /* Poison cleared on free: zeros expected instead. */
+    assert (memPool_init (&pool, ((uint8_t*) storage), 32U, 4U) == MEM_POOL_OK);
+    assert (memPool_setZeroPolicy (&pool, MEM_POOL_ZERO_ON_FREE, 0U) == MEM_POOL_OK);
+    assert (memPool_setDebug (&pool, MEM_POOL_DEBUG_POISON) == MEM_POOL_OK);
+    assert (memPool_alloc (&pool, &ptrSlot) == MEM_POOL_OK);
+    assert (memPool_free (&pool, ptrSlot) == MEM_POOL_OK);
+    assert (ptrSlot[31] == 0x00U);
+    assert (memPool_alloc (&pool, &ptrSlot) == MEM_POOL_OK);
+}
+
+static void
+test_order (void)
+{
+    uint64_t         storage[8U * 2U];
+    uint32_t         scratch[MEM_POOL_BITMAP_WORDS (8U)];
+    memPool_index_t  index[8];
+    memPool_handle_t pool;
+    uint8_t*         ptrSlots[8];
+    uint8_t*         ptrSlot;
+
+    /* Default LIFO, then sorted in one pass. */
+    assert (memPool_init (&pool, ((uint8_t*) storage), 16U, 8U) == MEM_POOL_OK);
+    assert (memPool_allocBulk (&pool, ptrSlots, 8U, NULL) == MEM_POOL_OK);
+    assert (memPool_setOrder (&pool, MEM_POOL_ORDER_ADDRESS) != MEM_POOL_OK);
+    assert (memPool_free (&pool, ptrSlots[6]) == MEM_POOL_OK);
+    assert (memPool_free (&pool, ptrSlots[1]) == MEM_POOL_OK);
+    assert (memPool_free (&pool, ptrSlots[4]) == MEM_POOL_OK);
+    assert (pool.ptrHead == ptrSlots[4]);
+    assert (memPool_compactFreeList (&pool, NULL) != MEM_POOL_OK);
+    assert (memPool_compactFreeList (&pool, scratch) == MEM_POOL_OK);
+    assert ((memPool_alloc (&pool, &ptrSlot) == MEM_POOL_OK) && (ptrSlot == ptrSlots[1]));
+    assert ((memPool_alloc (&pool, &ptrSlot) == MEM_POOL_OK) && (ptrSlot == ptrSlots[4]));
+    assert ((memPool_alloc (&pool, &ptrSlot) == MEM_POOL_OK) && (ptrSlot == ptrSlots[6]));
+
+    /* Address order: live slots dense at the low end. */
+    assert (memPool_init (&pool, ((uint8_t*) storage), 16U, 8U) == MEM_POOL_OK);
+    assert (memPool_setOrder (&pool, MEM_POOL_ORDER_ADDRESS) == MEM_POOL_OK);
+    assert (memPool_allocBulk (&pool, ptrSlots, 8U, NULL) == MEM_POOL_OK);
+    assert (memPool_free (&pool, ptrSlots[5]) == MEM_POOL_OK);
+    assert (memPool_free (&pool, ptrSlots[2]) == MEM_POOL_OK);
+    assert (memPool_free (&pool, ptrSlots[7]) == MEM_POOL_OK);
+    assert (memPool_free (&pool, ptrSlots[0]) == MEM_POOL_OK);
+    assert ((memPool_alloc (&pool, &ptrSlot) == MEM_POOL_OK) && (ptrSlot == ptrSlots[0]));
+    assert ((memPool_alloc (&pool, &ptrSlot) == MEM_POOL_OK) && (ptrSlot == ptrSlots[2]));
+    assert ((memPool_alloc (&pool, &ptrSlot) == MEM_POOL_OK) && (ptrSlot == ptrSlots[5]));
+
+    /* FIFO: freed order. */
+    assert (memPool_init (&pool, ((uint8_t*) storage), 16U, 8U) == MEM_POOL_OK);
+    assert (memPool_setOrder (&pool, MEM_POOL_ORDER_FIFO) == MEM_POOL_OK);
+    assert (memPool_allocBulk (&pool, ptrSlots, 8U, NULL) == MEM_POOL_OK);
+    assert (memPool_free (&pool, ptrSlots[5]) == MEM_POOL_OK);
+    assert (memPool_free (&pool, ptrSlots[2]) == MEM_POOL_OK);
+    assert ((memPool_alloc (&pool, &ptrSlot) == MEM_POOL_OK) && (ptrSlot == ptrSlots[5]));
+    assert (memPool_free (&pool, ptrSlots[7]) == MEM_POOL_OK);
+    assert ((memPool_alloc (&pool, &ptrSlot) == MEM_POOL_OK) && (ptrSlot == ptrSlots[2]));
+    assert ((memPool_alloc (&pool, &ptrSlot) == MEM_POOL_OK) && (ptrSlot == ptrSlots[7]));
+    assert (memPool_free (&pool, ptrSlots[3]) == MEM_POOL_OK);
+    assert (memPool_free (&pool, ptrSlots[1]) == MEM_POOL_OK);
+    assert (memPool_compactFreeList (&pool, scratch) == MEM_POOL_OK);
+    assert (memPool_free (&pool, ptrSlots[0]) == MEM_POOL_OK);
+    assert ((memPool_alloc (&pool, &ptrSlot) == MEM_POOL_OK) && (ptrSlot == ptrSlots[1]));
+    assert ((memPool_alloc (&pool, &ptrSlot) == MEM_POOL_OK) && (ptrSlot == ptrSlots[3]));
+    assert ((memPool_alloc (&pool, &ptrSlot) == MEM_POOL_OK) && (ptrSlot == ptrSlots[0]));
+
+    /* Out-of-band free list: address order, no FIFO. */
+    assert (memPool_initIndex (&pool, ((uint8_t*) storage), NULL, index, 16U, 8U) == MEM_POOL_OK);
+    assert (memPool_setOrder (&pool, MEM_POOL_ORDER_FIFO) != MEM_POOL_OK);
+    assert (memPool_setOrder (&pool, MEM_POOL_ORDER_ADDRESS) == MEM_POOL_OK);
+    assert (memPool_allocBulk (&pool, ptrSlots, 8U, NULL) == MEM_POOL_OK);
+    assert (memPool_free (&pool, ptrSlots[3]) == MEM_POOL_OK);
+    assert (memPool_free (&pool, ptrSlots[6]) == MEM_POOL_OK);
+    assert (memPool_free (&pool, ptrSlots[1]) == MEM_POOL_OK);
+    assert ((memPool_alloc (&pool, &ptrSlot) == MEM_POOL_OK) && (ptrSlot == ptrSlots[1]));
+    assert ((memPool_alloc (&pool, &ptrSlot) == MEM_POOL_OK) && (ptrSlot == ptrSlots[3]));
+
+    /* Out-of-band free list compacted. */
+    assert (memPool_initIndex (&pool, ((uint8_t*) storage), NULL, index, 16U, 8U) == MEM_POOL_OK);
+    assert (memPool_allocBulk (&pool, ptrSlots, 8U, NULL) == MEM_POOL_OK);
+    assert (memPool_free (&pool, ptrSlots[2]) == MEM_POOL_OK);
+    assert (memPool_free (&pool, ptrSlots[7]) == MEM_POOL_OK);
+    assert (memPool_free (&pool, ptrSlots[0]) == MEM_POOL_OK);
+    assert (memPool_compactFreeList (&pool, scratch) == MEM_POOL_OK);
+    assert ((memPool_alloc (&pool, &ptrSlot) == MEM_POOL_OK) && (ptrSlot == ptrSlots[0]));
+    assert ((memPool_alloc (&pool, &ptrSlot) == MEM_POOL_OK) && (ptrSlot == ptrSlots[2]));
+    assert ((memPool_alloc (&pool, &ptrSlot) == MEM_POOL_OK) && (ptrSlot == ptrSlots[7]));
+}
+
+static void
+test_visit (void* ptrContext, uint8_t* ptrSlot)
+{
+    memPool_handle_t* ptrPool;
+
+    /* Sweep: free every other slot visited. */
+    ptrPool = (memPool_handle_t*) ptrContext;
+
+    if ((((uintptr_t) (ptrSlot - ptrPool->ptrStorage) / ptrPool->slotSize) % 2U) == 0U)
+    {
+        assert (memPool_free (ptrPool, ptrSlot) == MEM_POOL_OK);
+    }
+    else
+    {
+        *((uint64_t*) ptrSlot) += 1U;
+    }
+}
+
+static void
+test_forEach (void)
+{
+    uint64_t             storage[300U];
+    uint32_t             bitmap[MEM_POOL_BITMAP_WORDS (300U)];
+    uint32_t             gen[300U];
+    memPool_handle_t     pool;
+    memPool_slotHandle_t slotHandle;
+    memPool_stats_t      stats;
+    uint64_t*            ptrSlot;
+    uint32_t             i;
+
+    assert (memPool_initBitmap (&pool, ((uint8_t*) storage), bitmap, sizeof (uint64_t), 300U) == MEM_POOL_OK);
+    assert (memPool_forEachAllocated (&pool, test_visit, &pool) == MEM_POOL_OK);
+    assert (memPool_setGenerations (&pool, gen) == MEM_POOL_OK);
+
+    for (i = 0U; i < 300U; i++)
+    {
+        assert (memPool_alloc (&pool, ((uint8_t**) &ptrSlot)) == MEM_POOL_OK);
+        *ptrSlot = i;
+    }
+
+    /* Free words skipped (slots 10 to 269 free). */
+    for (i = 10U; i < 270U; i++)
+    {
+        assert (memPool_free (&pool, ((uint8_t*) &storage[i])) == MEM_POOL_OK);
+    }
+
+    assert (memPool_forEachAllocated (&pool, test_visit, &pool) == MEM_POOL_OK);
+
+    for (i = 0U; i < 300U; i++)
+    {
+        assert (((bitmap[i / 32U] >> (i % 32U)) & 1U) == (((i < 10U) || (i >= 270U)) ? (i % 2U) : 0U));
+        assert ((((i < 10U) || (i >= 270U)) && ((i % 2U) != 0U)) ? (storage[i] == (i + 1U)) : true);
+    }
+
+    /* No bitmap. */
+    assert (memPool_init (&pool, ((uint8_t*) storage), sizeof (uint64_t), 300U) == MEM_POOL_OK);
+    assert (memPool_forEachAllocated (&pool, test_visit, &pool) != MEM_POOL_OK);
+
+    /* Release all at once: handles stale, bump pointer restarts. */
+    assert (memPool_initBitmap (&pool, ((uint8_t*) storage), bitmap, sizeof (uint64_t), 300U) == MEM_POOL_OK);
+    assert (memPool_setGenerations (&pool, gen) == MEM_POOL_OK);
+    assert (memPool_allocHandle (&pool, &slotHandle, NULL) == MEM_POOL_OK);
+
+    for (i = 1U; i < 100U; i++)
+    {
+        assert (memPool_alloc (&pool, ((uint8_t**) &ptrSlot)) == MEM_POOL_OK);
+    }
+
+    assert (memPool_free (&pool, ((uint8_t*) &storage[50])) == MEM_POOL_OK);
+    assert (memPool_reset (&pool) == MEM_POOL_OK);
+    assert ((bitmap[0] == 0U) && (bitmap[3] == 0U));
+    assert (memPool_free (&pool, ((uint8_t*) &storage[1])) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+    assert (memPool_resolve (&pool, slotHandle, ((uint8_t**) &ptrSlot)) != MEM_POOL_OK);
+    assert ((memPool_alloc (&pool, ((uint8_t**) &ptrSlot)) == MEM_POOL_OK) && (ptrSlot == &storage[0]));
+    assert (memPool_resolve (&pool, slotHandle, ((uint8_t**) &ptrSlot)) != MEM_POOL_OK);
+    assert (memPool_getStats (&pool, &stats) == MEM_POOL_OK);
+    assert ((stats.inUse == 1U) && (stats.highWater == 100U) && (stats.frees == 100U));
+}
+
+MEM_POOL_INLINE_DEFINE (testInline, 12U, 4U)
+
+static void
+test_inline (void)
+{
+    uint8_t* ptrSlots[4];
+    uint8_t* ptrSlot;
+    uint32_t i;
+
+    /* Stride rounded up to a pointer. */
+    assert (sizeof (testInlineStorage) == (4U * MEM_POOL_INLINE_STRIDE (12U)));
+    assert ((MEM_POOL_INLINE_STRIDE (12U) % sizeof (void*)) == 0U);
+
+    for (i = 0U; i < 4U; i++)
+    {
+        assert (testInline_alloc (&ptrSlots[i]) == MEM_POOL_OK);
+        assert (ptrSlots[i] == &((uint8_t*) testInlineStorage)[i * MEM_POOL_INLINE_STRIDE (12U)]);
+        (void) memset (ptrSlots[i], 0xFF, 12U);
+    }
+
+    assert ((testInline_alloc (&ptrSlot) == MEM_POOL_ERROR_SPACE) && (ptrSlot == NULL));
+
+    /* Range & slot boundary checked. */
+    assert (testInline_free (&ptrSlots[1][4]) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+    assert (testInline_free (&ptrSlots[3][MEM_POOL_INLINE_STRIDE (12U)]) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+    assert (testInline_free (ptrSlots[1]) == MEM_POOL_OK);
+    assert (testInline_free (ptrSlots[2]) == MEM_POOL_OK);
+
+    /* LIFO reuse, cleared. */
+    assert ((testInline_alloc (&ptrSlot) == MEM_POOL_OK) && (ptrSlot == ptrSlots[2]) && (ptrSlot[11] == 0U));
+    assert ((testInline_alloc (&ptrSlot) == MEM_POOL_OK) && (ptrSlot == ptrSlots[1]));
+
+    /* Release all. */
+    testInline_reset ();
+    assert (testInline_free (ptrSlots[0]) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+    assert ((testInline_alloc (&ptrSlot) == MEM_POOL_OK) && (ptrSlot == ptrSlots[0]));
+}
+
+static void
+test_snapshot (void)
+{
+    uint64_t             storage[2U][8U];
+    uint32_t             bitmap[2U][MEM_POOL_BITMAP_WORDS (8U)];
+    uint32_t             gen[2U][8U];
+    memPool_index_t      index[2U][8U];
+    memPool_handle_t     pool;
+    memPoolSnapshot_t    snapshot;
+    memPool_slotHandle_t slotHandle;
+    uint64_t*            ptrSlots[8];
+    uint64_t*            ptrSlot;
+    uint32_t             i;
+
+    assert (memPool_initBitmap (&pool, ((uint8_t*) storage[0]), bitmap[0], sizeof (uint64_t), 8U) == MEM_POOL_OK);
+    assert (memPool_setGenerations (&pool, gen[0]) == MEM_POOL_OK);
+    assert (memPool_allocHandle (&pool, &slotHandle, ((uint8_t**) &ptrSlots[0])) == MEM_POOL_OK);
+    *ptrSlots[0] = 100U;
+
+    for (i = 1U; i < 6U; i++)
+    {
+        assert (memPool_alloc (&pool, ((uint8_t**) &ptrSlots[i])) == MEM_POOL_OK);
+        *ptrSlots[i] = 100U + i;
+    }
+
+    assert (memPool_free (&pool, ((uint8_t*) ptrSlots[4])) == MEM_POOL_OK);
+    assert (memPool_free (&pool, ((uint8_t*) ptrSlots[1])) == MEM_POOL_OK);
+    assert (memPool_free (&pool, ((uint8_t*) ptrSlots[2])) == MEM_POOL_OK);
+
+    /* Links saved as slot indices, state copied elsewhere (another address). */
+    assert (memPoolSnapshot_save (&pool, &snapshot) == MEM_POOL_OK);
+    assert ((snapshot.head == 3U) && (storage[0][2] == 2U) && (storage[0][1] == 5U) && (storage[0][4] == 0U));
+    (void) memcpy (storage[1], storage[0], sizeof (storage[0]));
+    (void) memcpy (bitmap[1], bitmap[0], sizeof (bitmap[0]));
+    (void) memcpy (gen[1], gen[0], sizeof (gen[0]));
+    (void) memset (&pool, 0xFF, sizeof (pool));
+
+    /* Arrays must match the ones saved. */
+    assert (memPoolSnapshot_restore (&pool, &snapshot, ((uint8_t*) storage[1]), NULL, NULL, gen[1]) != MEM_POOL_OK);
+    assert (memPoolSnapshot_restore (&pool, &snapshot, ((uint8_t*) storage[1]), bitmap[1], NULL, gen[1]) ==
+            MEM_POOL_OK);
+
+    /* Objects and handles still valid, free list order kept. */
+    assert (memPool_resolve (&pool, slotHandle, ((uint8_t**) &ptrSlot)) == MEM_POOL_OK);
+    assert ((ptrSlot == &storage[1][0]) && (*ptrSlot == 100U) && (storage[1][5] == 105U));
+    assert (memPool_free (&pool, ((uint8_t*) &storage[1][1])) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+    assert ((memPool_alloc (&pool, ((uint8_t**) &ptrSlot)) == MEM_POOL_OK) && (ptrSlot == &storage[1][2]));
+    assert ((memPool_alloc (&pool, ((uint8_t**) &ptrSlot)) == MEM_POOL_OK) && (ptrSlot == &storage[1][1]));
+    assert ((memPool_alloc (&pool, ((uint8_t**) &ptrSlot)) == MEM_POOL_OK) && (ptrSlot == &storage[1][4]));
+    assert ((memPool_alloc (&pool, ((uint8_t**) &ptrSlot)) == MEM_POOL_OK) && (ptrSlot == &storage[1][6]));
+    assert (memPool_free (&pool, ((uint8_t*) &storage[1][3])) == MEM_POOL_OK);
+
+    /* Corrupted: link outside slots handed out, loop, wrong magic. */
+    assert (memPoolSnapshot_save (&pool, &snapshot) == MEM_POOL_OK);
+    storage[1][3] = 9U;
+    assert (memPoolSnapshot_restore (&pool, &snapshot, ((uint8_t*) storage[1]), bitmap[1], NULL, gen[1]) ==
+            MEM_POOL_ERROR_CORRUPTED);
+    storage[1][3] = 4U;
+    assert (memPoolSnapshot_restore (&pool, &snapshot, ((uint8_t*) storage[1]), bitmap[1], NULL, gen[1]) ==
+            MEM_POOL_ERROR_CORRUPTED);
+    snapshot.magic = 0U;
+    assert (memPoolSnapshot_restore (&pool, &snapshot, ((uint8_t*) storage[1]), bitmap[1], NULL, gen[1]) ==
+            MEM_POOL_ERROR_CORRUPTED);
+
+    /* Out-of-band free list: nothing rewritten in storage. */
+    assert (memPool_initIndex (&pool, ((uint8_t*) storage[0]), NULL, index[0], sizeof (uint64_t), 8U) == MEM_POOL_OK);
+    assert (memPool_allocBulk (&pool, ((uint8_t**) ptrSlots), 4U, NULL) == MEM_POOL_OK);
+    assert (memPool_free (&pool, ((uint8_t*) ptrSlots[1])) == MEM_POOL_OK);
+    *ptrSlots[1] = 0x1234U;
+    assert (memPoolSnapshot_save (&pool, &snapshot) == MEM_POOL_OK);
+    assert (*ptrSlots[1] == 0x1234U);
+    (void) memcpy (index[1], index[0], sizeof (index[0]));
+    assert (memPoolSnapshot_restore (&pool, &snapshot, ((uint8_t*) storage[1]), NULL, index[1], NULL) == MEM_POOL_OK);
+    assert ((memPool_alloc (&pool, ((uint8_t**) &ptrSlot)) == MEM_POOL_OK) && (ptrSlot == &storage[1][1]));
+}
+
+static void
+test_shm (void)
+{
+    memPoolShm_handle_t* ptrPool;
+    memPoolShm_handle_t* ptrView;
+    uint8_t*             ptrSlot;
+    uint8_t*             ptrPeer;
+    uint64_t             offset;
+    uint32_t             i;
+    int                  fds[2];
+    int                  status;
+    pid_t                pid;
+    char                 name[32];
+    _Alignas (MEM_POOL_CACHE_LINE) uint8_t region[MEM_POOL_SHM_REGION_SIZE (16U, SHM_SLOTS)];
+
+    (void) snprintf (name, sizeof (name), "/memPoolTest%d", (int) getpid ());
+
+    /* Created, then opened again: two mappings of the same object, at different addresses. */
+    assert (memPoolShm_create (name, 16U, SHM_SLOTS, &ptrPool) == MEM_POOL_OK);
+    assert (memPoolShm_create (name, 16U, SHM_SLOTS, &ptrView) == MEM_POOL_ERROR_SPACE);
+    assert (memPoolShm_open (name, &ptrView) == MEM_POOL_OK);
+    assert (ptrView != ptrPool);
+
+    /* Written through one mapping, read (by offset) and freed through the other. */
+    assert (memPoolShm_alloc (ptrPool, &ptrSlot) == MEM_POOL_OK);
+    (void) strcpy ((char*) ptrSlot, "zero copy");
+    assert (memPoolShm_offset (ptrPool, ptrSlot, &offset) == MEM_POOL_OK);
+    assert (memPoolShm_slot (ptrView, (offset + 4U), &ptrPeer) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+    assert (memPoolShm_slot (ptrView, (offset + 16U), &ptrPeer) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+    assert (memPoolShm_slot (ptrView, offset, &ptrPeer) == MEM_POOL_OK);
+    assert ((ptrPeer != ptrSlot) && (strcmp ((char*) ptrPeer, "zero copy") == 0));
+    assert (memPoolShm_free (ptrView, ptrPeer) == MEM_POOL_OK);
+    assert (memPoolShm_free (ptrPool, ptrSlot) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+
+    /* Producer process passes offsets through a pipe, consumer frees slots (pool smaller than messages). */
+    assert (pipe (fds) == 0);
+    pid = fork ();
+    assert (pid >= 0);
+
+    if (pid == 0)
+    {
+        memPoolShm_handle_t* ptrProducer;
+
+        (void) close (fds[0]);
+        status = (memPoolShm_open (name, &ptrProducer) == MEM_POOL_OK) ? 0 : 1;
+
+        for (i = 0U; (i < SHM_MESSAGES) && (status == 0); i++)
+        {
+            while (memPoolShm_alloc (ptrProducer, &ptrSlot) != MEM_POOL_OK)
+            {
+                (void) sched_yield ();
+            }
+
+            (void) memcpy (ptrSlot, &i, sizeof (i));
+            status = ((memPoolShm_offset (ptrProducer, ptrSlot, &offset) == MEM_POOL_OK) &&
+                      (write (fds[1], &offset, sizeof (offset)) == sizeof (offset))) ? 0 : 1;
+        }
+
+        _exit (status);
+    }
+
+    (void) close (fds[1]);
+
+    for (i = 0U; i < SHM_MESSAGES; i++)
+    {
+        assert (read (fds[0], &offset, sizeof (offset)) == sizeof (offset));
+        assert (memPoolShm_slot (ptrView, offset, &ptrPeer) == MEM_POOL_OK);
+        assert (memcmp (ptrPeer, &i, sizeof (i)) == 0);
+        assert (memPoolShm_free (ptrView, ptrPeer) == MEM_POOL_OK);
+    }
+
+    (void) close (fds[0]);
+    assert ((waitpid (pid, &status, 0) == pid) && WIFEXITED (status) && (WEXITSTATUS (status) == 0));
+
+    /* No slot leaked. */
+    for (i = 0U; i < SHM_SLOTS; i++)
+    {
+        assert (memPoolShm_alloc (ptrPool, &ptrSlot) == MEM_POOL_OK);
+    }
+
+    assert (memPoolShm_alloc (ptrPool, &ptrSlot) == MEM_POOL_ERROR_SPACE);
+
+    /* Region without a pool. */
+    (void) memset (region, 0x00, sizeof (region));
+    assert (memPoolShm_attach (region, sizeof (region), &ptrView) == MEM_POOL_ERROR_CORRUPTED);
+    assert (memPoolShm_init (region, (sizeof (region) - 1U), 16U, SHM_SLOTS, &ptrView) == MEM_POOL_ERROR_PARAMETERS);
+    assert (memPoolShm_init (region, sizeof (region), 16U, SHM_SLOTS, &ptrView) == MEM_POOL_OK);
+    assert (memPoolShm_attach (region, (sizeof (region) - 1U), &ptrView) == MEM_POOL_ERROR_CORRUPTED);
+    assert ((memPoolShm_attach (region, sizeof (region), &ptrView) == MEM_POOL_OK) && (ptrView == (void*) region));
+    assert (memPoolShm_open (name, &ptrView) == MEM_POOL_OK);
+
+    assert (memPoolShm_close (ptrView) == MEM_POOL_OK);
+    assert (memPoolShm_close (ptrPool) == MEM_POOL_OK);
+    assert (shm_unlink (name) == 0);
+}
+
+static memPoolTrace_event_t traceEvents[MEM_POOL_TRACE_EVENTS];
+static uint32_t             traceCount;
+
+static void
+test_traceSink (void* ptrContext, const memPoolTrace_event_t* ptrEvents, uint32_t count)
+{
+    /* No context: events discarded. */
+    if (ptrContext != NULL)
+    {
+        assert ((traceCount + count) <= MEM_POOL_TRACE_EVENTS);
+        (void) memcpy (&traceEvents[traceCount], ptrEvents, (count * sizeof (*ptrEvents)));
+        traceCount += count;
+    }
+}
+
+static void*
+test_traceThread (void* ptrArg)
+{
+    test_t           storage[SLOTS];
+    memPool_handle_t pool;
+    test_t*          ptrSlot;
+
+    (void) ptrArg;
+
+    /* Two events: claims a ring, if any left. */
+    assert (memPool_init (&pool, ((uint8_t*) storage), sizeof (test_t), SLOTS) == MEM_POOL_OK);
+    assert (memPool_alloc (&pool, ((uint8_t**) &ptrSlot)) == MEM_POOL_OK);
+    assert (memPool_free (&pool, ((uint8_t*) ptrSlot)) == MEM_POOL_OK);
+
+    return NULL;
+}
+
+static void
+test_trace (void)
+{
+    test_t                    storage[SLOTS];
+    memPool_handle_t          pool;
+    memPoolTrace_fileHeader_t header;
+    memPoolSet_handle_t       set;
+    memPool_slotHandle_t      handles[2];
+    pthread_t                 thread;
+    uint64_t                  setStorage[(2U * 16U) / sizeof (uint64_t)];
+    uint64_t                  dropped;
+    uint32_t                  gen[SLOTS];
+    uint32_t                  i;
+    bool                      zeroed;
+    test_t*                   ptrSlot;
+    uint8_t*                  ptrSmall[2];
+
+    assert (memPoolTrace_fileHeader (&header) == MEM_POOL_OK);
+    assert ((header.magic == MEM_POOL_TRACE_MAGIC) && (header.eventSize == sizeof (memPoolTrace_event_t)));
+
+    /* Events of earlier tests. */
+    assert (memPoolTrace_drain (test_traceSink, NULL, NULL) == MEM_POOL_OK);
+
+    assert (memPool_init (&pool, ((uint8_t*) storage), sizeof (test_t), SLOTS) == MEM_POOL_OK);
+    assert (memPool_alloc (&pool, ((uint8_t**) &ptrSlot)) == MEM_POOL_OK);
+    assert (memPool_alloc (&pool, ((uint8_t**) &ptrSlot)) == MEM_POOL_OK);
+    assert (memPool_free (&pool, ((uint8_t*) &storage[0])) == MEM_POOL_OK);
+    assert (memPool_allocZeroed (&pool, ((uint8_t**) &ptrSlot), &zeroed) == MEM_POOL_OK);
+
+    /* Failures are not traced. */
+    assert (memPool_free (&pool, ((uint8_t*) &storage[2])) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+
+    traceCount = 0U;
+    assert (memPoolTrace_drain (test_traceSink, &traceCount, &dropped) == MEM_POOL_OK);
+    assert ((traceCount == 4U) && (dropped == 0U));
+
+    assert ((traceEvents[0].type == MEM_POOL_TRACE_ALLOC) && (traceEvents[0].slot == 0U));
+    assert ((traceEvents[1].type == MEM_POOL_TRACE_ALLOC) && (traceEvents[1].slot == 1U));
+    assert ((traceEvents[2].type == MEM_POOL_TRACE_FREE)  && (traceEvents[2].slot == 0U));
+    assert ((traceEvents[3].type == MEM_POOL_TRACE_ALLOC) && (traceEvents[3].slot == 0U));
+
+    /* Caller is the call site. */
+    assert ((traceEvents[0].caller != 0U) && (traceEvents[0].caller != traceEvents[1].caller));
+
+    for (i = 0U; i < traceCount; i++)
+    {
+        assert (traceEvents[i].pool   == (uint64_t) (uintptr_t) &pool);
+        assert (traceEvents[i].thread == traceEvents[0].thread);
+        assert ((i == 0U) || (traceEvents[i].timestamp >= traceEvents[i - 1U].timestamp));
+    }
+
+    /* Ring overrun: oldest events overwritten (and the one next in line, maybe torn), counted as dropped. */
+    for (i = 0U; i < MEM_POOL_TRACE_EVENTS; i++)
+    {
+        assert (memPool_free (&pool, ((uint8_t*) ptrSlot)) == MEM_POOL_OK);
+        assert (memPool_alloc (&pool, ((uint8_t**) &ptrSlot)) == MEM_POOL_OK);
+    }
+
+    traceCount = 0U;
+    assert (memPoolTrace_drain (test_traceSink, &traceCount, &dropped) == MEM_POOL_OK);
+    assert ((traceCount == (MEM_POOL_TRACE_EVENTS - 1U)) && (dropped == (MEM_POOL_TRACE_EVENTS + 1U)));
+    assert ((traceEvents[0].type == MEM_POOL_TRACE_ALLOC) && (traceEvents[traceCount - 1U].type == MEM_POOL_TRACE_ALLOC));
+
+    /* Wrappers trace their own caller: two call sites, two callers. */
+    assert (memPoolSet_init (&set, ((uint8_t*) setStorage), sizeof (setStorage), &(const memPoolSet_class_t) { 16U, 2U },
+                             1U) == MEM_POOL_OK);
+    assert (memPoolSet_alloc (&set, 16U, &ptrSmall[0]) == MEM_POOL_OK);
+    assert (memPoolSet_alloc (&set, 16U, &ptrSmall[1]) == MEM_POOL_OK);
+    assert (memPoolSet_free (&set, ptrSmall[0]) == MEM_POOL_OK);
+    assert (memPoolSet_free (&set, ptrSmall[1]) == MEM_POOL_OK);
+
+    assert (memPool_init (&pool, ((uint8_t*) storage), sizeof (test_t), SLOTS) == MEM_POOL_OK);
+    assert (memPool_setGenerations (&pool, gen) == MEM_POOL_OK);
+    assert (memPool_allocHandle (&pool, &handles[0], NULL) == MEM_POOL_OK);
+    assert (memPool_allocHandle (&pool, &handles[1], NULL) == MEM_POOL_OK);
+
+    traceCount = 0U;
+    assert (memPoolTrace_drain (test_traceSink, &traceCount, &dropped) == MEM_POOL_OK);
+    assert ((traceCount == 6U) && (dropped == 0U));
+
+    for (i = 0U; i < traceCount; i += 2U)
+    {
+        assert (traceEvents[i].caller != traceEvents[i + 1U].caller);
+    }
+
+    /* More threads than rings: events of threads left with no ring are dropped. */
+    for (i = 0U; i < (MEM_POOL_TRACE_THREADS + 2U); i++)
+    {
+        assert (pthread_create (&thread, NULL, test_traceThread, NULL) == 0);
+        assert (pthread_join (thread, NULL) == 0);
+    }
+
+    traceCount = 0U;
+    assert (memPoolTrace_drain (test_traceSink, &traceCount, &dropped) == MEM_POOL_OK);
+    assert ((dropped >= 4U) && ((traceCount + dropped) == (2U * (MEM_POOL_TRACE_THREADS + 2U))));
+}
+
+static void
+test_doubleFree (void)
+{
+    test_t           storage[SLOTS];
+    memPool_handle_t pool;
+    test_t*          ptrSlot;
+    test_t*          ptrOther;
+
+    /* Plain pool (no bitmap): free list walked. */
+    assert (memPool_init (&pool, ((uint8_t*) storage), sizeof (test_t), SLOTS) == MEM_POOL_OK);
+    assert (memPool_alloc (&pool, ((uint8_t**) &ptrSlot)) == MEM_POOL_OK);
+    assert (memPool_alloc (&pool, ((uint8_t**) &ptrOther)) == MEM_POOL_OK);
+    assert (memPool_free (&pool, ((uint8_t*) ptrSlot)) == MEM_POOL_OK);
+    assert (memPool_free (&pool, ((uint8_t*) ptrSlot)) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+
+    /* Free list intact: slot handed out once. */
+    assert (memPool_alloc (&pool, ((uint8_t**) &ptrOther)) == MEM_POOL_OK);
+    assert (ptrOther == ptrSlot);
+    assert (memPool_alloc (&pool, ((uint8_t**) &ptrOther)) == MEM_POOL_OK);
+    assert (ptrOther == &storage[2]);
+    assert (memPool_alloc (&pool, ((uint8_t**) &ptrOther)) == MEM_POOL_ERROR_SPACE);
+}
+
+static void
+test_map (void)
+{
+    memPoolMap_nodeSet_t set;
+    memPool_handle_t     pool;
+    uint8_t*             ptrStorage;
+    size_t               mapped;
+    uint32_t             i;
+    int                  status[2];
+    void*                ptrPages[2];
+    uint8_t*             ptrSlot;
+
+    /* Lazily populated storage, huge pages (THP fallback if none reserved). */
+    assert (memPoolMap_reserve (&ptrStorage, 100000U, MEM_POOL_MAP_FLAG_HUGETLB, MEM_POOL_MAP_NO_NODE, &mapped) == MEM_POOL_OK);
+    assert ((ptrStorage != NULL) && (mapped >= 100000U));
+
+    assert (memPool_init (&pool, ptrStorage, 64U, 1000U) == MEM_POOL_OK);
+
+    for (i = 0U; i < 1000U; i++)
+    {
+        assert (memPool_alloc (&pool, &ptrSlot) == MEM_POOL_OK);
+    }
+
+    assert (memPool_alloc (&pool, &ptrSlot) == MEM_POOL_ERROR_SPACE);
+    assert (memPoolMap_release (ptrStorage, mapped) == MEM_POOL_OK);
+
+    /* Node out of range. */
+    assert (memPoolMap_reserve (&ptrStorage, 4096U, MEM_POOL_MAP_FLAG_NONE, -2, &mapped) == MEM_POOL_ERROR_PARAMETERS);
+    assert (memPoolMap_reserve (&ptrStorage, 4096U, MEM_POOL_MAP_FLAG_NONE, 64, &mapped) == MEM_POOL_ERROR_PARAMETERS);
+
+    /* Prefaulted & bound to node 0: pages present, on node 0 (if the kernel reports it). */
+    assert (memPoolMap_reserve (&ptrStorage, 8192U, MEM_POOL_MAP_FLAG_POPULATE, 0, &mapped) == MEM_POOL_OK);
+    ptrPages[0] = ptrStorage;
+    ptrPages[1] = &ptrStorage[mapped - 1U];
+    status[0]   = -1;
+    status[1]   = -1;
+
+    if (syscall (SYS_move_pages, 0, 2UL, ptrPages, NULL, status, 0) == 0)
+    {
+        assert ((status[0] == 0) && (status[1] == 0));
+    }
+
+    assert (memPoolMap_release (ptrStorage, mapped) == MEM_POOL_OK);
+
+    /* Node set (node 0 only: always present). */
+    assert (memPoolMap_nodeSetInit (&set, 64U, 0U, 1U, MEM_POOL_MAP_FLAG_NONE) != MEM_POOL_OK);
+    assert (memPoolMap_nodeSetInit (&set, 64U, 16U, (MEM_POOL_MAP_NODES + 1U), MEM_POOL_MAP_FLAG_NONE) != MEM_POOL_OK);
+    assert (memPoolMap_nodeSetInit (&set, 64U, 16U, 1U, MEM_POOL_MAP_FLAG_THP) == MEM_POOL_OK);
+
+    for (i = 0U; i < 16U; i++)
+    {
+        assert (memPoolMap_nodeSetAlloc (&set, &ptrSlot) == MEM_POOL_OK);
+        assert (ptrSlot == &set.ptrStorage[0][i * 64U]);
+    }
+
+    assert (memPoolMap_nodeSetAlloc (&set, &ptrSlot) == MEM_POOL_ERROR_SPACE);
+    assert (memPoolMap_nodeSetFree (&set, &set.ptrStorage[0][64U]) == MEM_POOL_OK);
+    assert (memPoolMap_nodeSetFree (&set, &set.ptrStorage[0][64U]) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+    assert (memPoolMap_nodeSetFree (&set, &set.ptrStorage[0][16U * 64U]) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
+    assert (memPoolMap_nodeSetAlloc (&set, &ptrSlot) == MEM_POOL_OK);
+    assert (ptrSlot == &set.ptrStorage[0][64U]);
+
+    assert (memPoolMap_nodeSetDeinit (&set) == MEM_POOL_OK);
+}
+
 int
 main (void)
 {
@@ -92,6 +2007,33 @@ main (void)
 
     assert (memPool_free (&pool, ((uint8_t*) &storage[0])) == MEM_POOL_ERROR_SLOT_NOT_ALLOCATED);
 
+    test_bitmap ();
+    test_doubleFree ();
+    test_lazyInit ();
+    test_stats ();
+    test_aligned ();
+    test_bulk ();
+    test_set ();
+    test_grow ();
+    test_mtStress ();
+    test_mtBulk ();
+    test_magazine ();
+    test_map ();
+    test_zeroPolicy ();
+    test_cpp ();
+    test_obj ();
+    test_index ();
+    test_handle ();
+    test_remote ();
+    test_debug ();
+    test_order ();
+    test_forEach ();
+    test_inline ();
+    test_snapshot ();
+    test_shm ();
+    test_queue ();
+    test_trace ();
+
     return 0;
 }
 
@@ -0,0 +1,164 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2021 Alessandro Morniroli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file   mainCpp.cpp
+ * @author Alessandro Morniroli <alessandro.morniroli@gmail.com>
+ * @date   Sun Oct 18 2026
+ *
+ * @brief  C++ wrapper unit test (called by main.c).
+ */
+
+#include <cassert>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory_resource>
+
+#include "memPool.hpp"
+
+namespace
+{
+
+struct Point
+{
+    Point (int xInit, int yInit) : x (xInit), y (yInit)
+    {
+        constructed++;
+    }
+
+    ~Point ()
+    {
+        destructed++;
+    }
+
+    int x;
+    int y;
+
+    static int constructed;
+    static int destructed;
+};
+
+int Point::constructed = 0;
+int Point::destructed  = 0;
+
+struct alignas (64) Line
+{
+    std::uint8_t bytes[40];
+};
+
+void
+test_pool (void)
+{
+    memPool::Pool<Point, 2U> pool;
+
+    static_assert (memPool::Pool<Point, 2U>::slotStride == 8U, "stride");
+    static_assert (memPool::Pool<std::uint8_t, 4U>::slotStride == sizeof (std::uint8_t*), "stride at least a pointer");
+    static_assert (memPool::Pool<Line, 4U>::slotStride == 64U, "stride aligned");
+    static_assert (memPool::Pool<std::uint64_t, 4U, 32U>::slotAlign == 32U, "alignment");
+
+    {
+        memPool::Pool<Point, 2U>::Ptr first  = pool.make (1, 2);
+        memPool::Pool<Point, 2U>::Ptr second = pool.make (3, 4);
+
+        assert ((first != nullptr) && (second != nullptr));
+        assert ((first->x == 1) && (second->y == 4));
+        assert (pool.owns (first.get ()) && pool.owns (second.get ()));
+
+        /* Exhausted. */
+        assert (pool.make (5, 6) == nullptr);
+        assert (Point::constructed == 2);
+
+        /* Slot back to pool on reset. */
+        first.reset ();
+        assert (Point::destructed == 1);
+        assert (pool.make (7, 8) != nullptr);
+        assert (Point::destructed == 2);
+    }
+
+    assert (Point::destructed == 3);
+
+    /* Double free detected. */
+    Point* ptr = pool.construct (9, 10);
+    pool.destroy (ptr);
+    assert (pool.deallocate (ptr) == false);
+
+    /* Aligned slots. */
+    memPool::Pool<Line, 4U> lines;
+
+    for (int i = 0; i < 4; i++)
+    {
+        Line* ptrLine = lines.allocate ();
+
+        assert ((ptrLine != nullptr) && ((reinterpret_cast<std::uintptr_t> (ptrLine) % 64U) == 0U));
+    }
+
+    assert (lines.allocate () == nullptr);
+}
+
+void
+test_resource (void)
+{
+    memPool::Resource<64U, 16U> resource;
+    std::pmr::list<int>         list{&resource};
+    std::uint32_t               inPool;
+
+    /* List nodes come from pool. */
+    for (int i = 0; i < 8; i++)
+    {
+        list.push_back (i);
+    }
+
+    inPool = 0U;
+
+    for (const int& value : list)
+    {
+        inPool += resource.pool ().owns (&value) ? 1U : 0U;
+    }
+
+    assert (inPool == 8U);
+
+    /* Pool exhausted: spill to upstream. */
+    for (int i = 0; i < 16; i++)
+    {
+        list.push_back (i);
+    }
+
+    assert (list.size () == 24U);
+    list.clear ();
+
+    /* Through the allocator adapter. */
+    std::map<int, int, std::less<int>, memPool::Allocator<std::pair<const int, int>>> map{&resource};
+
+    map[1] = 10;
+    map[2] = 20;
+    assert (resource.pool ().owns (&map[1]) && (map[2] == 20));
+}
+
+} /* namespace */
+
+extern "C" void
+test_cpp (void)
+{
+    test_pool ();
+    test_resource ();
+}
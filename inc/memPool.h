@@ -38,36 +38,164 @@
  * ************************************************************************** */
 
 /* Standard C. */
+#include <stdbool.h>
 #include <stdint.h>
+/* Module include. */
+#include "memPool_conf.h"
 
 /* ************************************************************************** *
  *                          End of includes section                           *
  * ************************************************************************** */
 
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
 
 /* ************************************************************************** *
  *                    Start of global definitions section                     *
  * ************************************************************************** */
 
+/**
+ * Number of 32-bit words needed by the allocation bitmap of a pool made of
+ * \p slotNumber slots (see \ref memPool_initBitmap).
+ */
+#define MEM_POOL_BITMAP_WORDS(slotNumber) ((((uint32_t) (slotNumber)) + 31U) / 32U)
+
+/**
+ * Slot stride of a pool whose slots of \p slotSize bytes are aligned to
+ * \p alignment bytes (power of two, see \ref memPool_initAligned).
+ */
+#define MEM_POOL_ALIGNED_STRIDE(slotSize, alignment) \
+    ((((uint32_t) (slotSize)) + ((uint32_t) (alignment)) - 1U) & ~(((uint32_t) (alignment)) - 1U))
+
+/**
+ * Storage size needed by \ref memPool_initAligned to provide \p slotNumber
+ * slots, whatever the storage address is.
+ */
+#define MEM_POOL_ALIGNED_STORAGE_SIZE(slotSize, alignment, slotNumber) \
+    ((MEM_POOL_ALIGNED_STRIDE ((slotSize), (alignment)) * ((uint32_t) (slotNumber))) + ((uint32_t) (alignment)) - 1U)
+
+/**
+ * Debug checks enabled per pool (see \ref memPool_setDebug, \ref MEM_POOL_DEBUG).
+ */
+#define MEM_POOL_DEBUG_POISON 0x01U /**< Freed slots poisoned, checked on alloc (use after free). */
+#define MEM_POOL_DEBUG_CANARY 0x02U /**< Canary at slot end, checked on free (overflow).          */
+
+/**
+ * Bytes at the end of each slot holding the canary (\ref MEM_POOL_DEBUG_CANARY):
+ * usable slot size is slotSize minus this.
+ */
+#define MEM_POOL_CANARY_SIZE 8U
+
+/**
+ * Slot index of an out-of-band free list (see \ref memPool_initIndex,
+ * \ref MEM_POOL_INDEX_BITS).
+ */
+#if (defined MEM_POOL_INDEX_BITS && (MEM_POOL_INDEX_BITS == 16))
+typedef uint16_t memPool_index_t;
+#else
+typedef uint32_t memPool_index_t;
+#endif /* MEM_POOL_INDEX_BITS && (MEM_POOL_INDEX_BITS == 16) */
+
+/**
+ * Slot handle: slot index (low \ref MEM_POOL_HANDLE_INDEX_BITS bits) and
+ * generation (see \ref memPool_allocHandle, \ref MEM_POOL_HANDLE_BITS).
+ */
+#if (defined MEM_POOL_HANDLE_BITS && (MEM_POOL_HANDLE_BITS == 64))
+typedef uint64_t memPool_slotHandle_t;
+#else
+typedef uint32_t memPool_slotHandle_t;
+#endif /* MEM_POOL_HANDLE_BITS && (MEM_POOL_HANDLE_BITS == 64) */
+
+/**
+ * Slot handle never returned by \ref memPool_allocHandle (generations start
+ * from 1).
+ */
+#define MEM_POOL_SLOT_HANDLE_NULL ((memPool_slotHandle_t) 0U)
+
 /**
  * Memory pool errors.
  */
 typedef enum
 {
-    MEM_POOL_OK,                      /**< No error occurred.         */
-    MEM_POOL_ERROR_PARAMETERS,        /**< Wrong function parameters. */
-    MEM_POOL_ERROR_SPACE,             /**< No more space to allocate. */
-    MEM_POOL_ERROR_SLOT_NOT_ALLOCATED /**< Slot was not allocated.    */
+    MEM_POOL_OK,                       /**< No error occurred.         */
+    MEM_POOL_ERROR_PARAMETERS,         /**< Wrong function parameters. */
+    MEM_POOL_ERROR_SPACE,              /**< No more space to allocate. */
+    MEM_POOL_ERROR_SLOT_NOT_ALLOCATED, /**< Slot was not allocated.    */
+    MEM_POOL_ERROR_CORRUPTED           /**< Corrupt slot or snapshot.  */
 } memPool_error_t;
 
+/**
+ * Memory pool statistics (see \ref MEM_POOL_STATS).
+ */
+typedef struct
+{
+    uint32_t inUse;         /**< Slots currently allocated.                */
+    uint32_t highWater;     /**< Maximum number of slots ever allocated.   */
+    uint64_t allocs;        /**< Total number of slots allocated.          */
+    uint64_t frees;         /**< Total number of slots freed.              */
+    uint64_t allocFailures; /**< Allocations failed (no more space).       */
+    uint64_t freeFailures;  /**< Frees failed (slot was not allocated).    */
+} memPool_stats_t;
+
+/**
+ * Slot clearing policy (see \ref memPool_setZeroPolicy, \ref memPool_zeroize).
+ */
+typedef enum
+{
+    MEM_POOL_ZERO_ON_ALLOC,  /**< Whole slot cleared on alloc (default).                  */
+    MEM_POOL_ZERO_ON_FREE,   /**< Whole slot cleared on free (hot in cache).              */
+    MEM_POOL_ZERO_DEFERRED,  /**< Freed slots cleared by \ref memPool_zeroDirty.          */
+    MEM_POOL_ZERO_PARTIAL    /**< First zeroBytes bytes cleared on alloc.                 */
+} memPool_zeroPolicy_t;
+
+/**
+ * Free list order (see \ref memPool_setOrder, \ref MEM_POOL_FREE_ORDER).
+ */
+typedef enum
+{
+    MEM_POOL_ORDER_LIFO,    /**< Last freed handed out first, hot in cache (default). */
+    MEM_POOL_ORDER_ADDRESS, /**< Lowest address first, live slots kept dense (O(n)).  */
+    MEM_POOL_ORDER_FIFO     /**< First freed handed out first, wear spread.           */
+} memPool_order_t;
+
+/**
+ * Live slot visitor callback (see \ref memPool_forEachAllocated).
+ */
+typedef void (*memPool_visit_t) (void* ptrContext, uint8_t* ptrSlot);
+
 /**
  * Memory pool handle.
  */
 typedef struct
 {
-    uint8_t* ptrHead;    /**< Pointer to next available slot. */
-    uint32_t slotSize;   /**< Single slot size (bytes).       */
-    uint32_t slotNumber; /**< Total number of slots.          */
+    uint8_t*         ptrHead;    /**< Pointer to next available slot.            */
+    uint8_t*         ptrStorage; /**< Pointer to first slot.                     */
+    uint32_t*        ptrBitmap;  /**< Allocation bitmap (NULL if not supplied).  */
+    memPool_index_t* ptrIndex;   /**< Out-of-band free list (NULL if none).      */
+    uint32_t         indexTop;   /**< Number of slot indices on ptrIndex.        */
+    uint32_t*        ptrGen;     /**< Slot generations (NULL if no handles).     */
+    uint32_t         slotSize;   /**< Single slot size (bytes).                  */
+    uint32_t         slotNumber; /**< Total number of slots.                     */
+    uint32_t         bumpIndex;  /**< Index of first slot never handed out.      */
+    uint32_t         bumpHigh;   /**< Highest bumpIndex before last reset.       */
+#if (defined memPool_zeroize && (memPool_zeroize == 1))
+    uint8_t*             ptrDirty;   /**< Freed slots not cleared yet (deferred).     */
+    memPool_zeroPolicy_t zeroPolicy; /**< Slot clearing policy.                       */
+    uint32_t             zeroBytes;  /**< Bytes cleared on alloc (partial policy).    */
+#endif /* memPool_zeroize && (memPool_zeroize == 1) */
+#if (defined MEM_POOL_FREE_ORDER && (MEM_POOL_FREE_ORDER == 1))
+    memPool_order_t order;   /**< Free list order.                            */
+    uint8_t*        ptrTail; /**< Last slot of free list (FIFO, if not empty). */
+#endif /* MEM_POOL_FREE_ORDER && (MEM_POOL_FREE_ORDER == 1) */
+#if (defined MEM_POOL_DEBUG && (MEM_POOL_DEBUG == 1))
+    uint32_t debugFlags;  /**< Debug checks (MEM_POOL_DEBUG_xxx flags).    */
+    uint32_t corruptions; /**< Corrupted slots detected (quarantined).     */
+#endif /* MEM_POOL_DEBUG && (MEM_POOL_DEBUG == 1) */
+#if (defined MEM_POOL_STATS && (MEM_POOL_STATS == 1))
+    memPool_stats_t stats; /**< Statistics (high water mark from bumpIndex). */
+#endif /* MEM_POOL_STATS && (MEM_POOL_STATS == 1) */
 } memPool_handle_t;
 
 /* ************************************************************************** *
@@ -91,7 +219,10 @@ typedef struct
 /**
  * @brief Initialize mempool routine.
  *
- * When called, memory pool handle is initialized (all slots available).
+ * When called, memory pool handle is initialized (all slots available). The
+ * cost is O(1): storage is not touched, slots are handed out in address order
+ * by a bump pointer and join the free list only once freed. \p slotSize must
+ * be at least the size of a pointer (free list is intrusive).
  *
  * @return MEM_POOL_OK if no error occurred; anything else otherwise.
  */
@@ -101,6 +232,63 @@ memPool_init (memPool_handle_t* ptrHandle,
               uint32_t          slotSize,
               uint32_t          slotNumber);
 
+/**
+ * @brief Initialize mempool routine (with allocation bitmap).
+ *
+ * As \ref memPool_init, but the pool keeps track of allocated slots into
+ * \p ptrBitmap (one bit per slot, \ref MEM_POOL_BITMAP_WORDS words), so that
+ * \ref memPool_free detects a slot that was not allocated in constant time.
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPool_initBitmap (memPool_handle_t* ptrHandle,
+                    uint8_t*          ptrStorage,
+                    uint32_t*         ptrBitmap,
+                    uint32_t          slotSize,
+                    uint32_t          slotNumber);
+
+/**
+ * @brief Initialize mempool routine (with out-of-band free list).
+ *
+ * As \ref memPool_initBitmap (\p ptrBitmap is optional), but the free list is
+ * a stack of slot indices kept into \p ptrIndex (\p slotNumber entries of
+ * \ref memPool_index_t) instead of being linked through freed slots: freed
+ * slot contents are never written by the pool (but for clear on free policy),
+ * storage may be cold or shared, and slots may be smaller than a pointer
+ * (down to 1 byte). With 16-bit indices, at most 65536 slots.
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPool_initIndex (memPool_handle_t* ptrHandle,
+                   uint8_t*          ptrStorage,
+                   uint32_t*         ptrBitmap,
+                   memPool_index_t*  ptrIndex,
+                   uint32_t          slotSize,
+                   uint32_t          slotNumber);
+
+/**
+ * @brief Initialize mempool routine (with slot alignment).
+ *
+ * First slot is aligned to \p alignment (power of two, e.g. 8, 16, 64 or
+ * 4096) inside \p ptrStorage (\p storageSize bytes) and slot stride is
+ * \p slotSize rounded up to \p alignment, so that every slot is aligned (e.g.
+ * cache line or SIMD). Number of slots that fit after padding is stored in
+ * \p ptrSlotNumber. \p ptrBitmap is optional (see \ref memPool_initBitmap):
+ * size it for storageSize / slotSize slots.
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPool_initAligned (memPool_handle_t* ptrHandle,
+                     uint8_t*          ptrStorage,
+                     uint32_t          storageSize,
+                     uint32_t*         ptrBitmap,
+                     uint32_t          slotSize,
+                     uint32_t          alignment,
+                     uint32_t*         ptrSlotNumber);
+
 /**
  * mempool alloc routine.
  *
@@ -109,16 +297,243 @@ memPool_init (memPool_handle_t* ptrHandle,
 memPool_error_t
 memPool_alloc (memPool_handle_t* ptrHandle, uint8_t** ptr2Slot);
 
+/**
+ * @brief mempool alloc routine (reporting slot clearing).
+ *
+ * As \ref memPool_alloc; \p ptrZeroed is set to true if the whole slot is
+ * known to be zero, false if the caller must clear what it needs (partial or
+ * deferred policy, or \ref memPool_zeroize disabled).
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPool_allocZeroed (memPool_handle_t* ptrHandle, uint8_t** ptr2Slot, bool* ptrZeroed);
+
+/**
+ * @brief mempool alloc routine (pool may be exhausted).
+ *
+ * As \ref memPool_alloc, but \ref MEM_POOL_ERROR_SPACE is not asserted: for
+ * callers falling back on something else when the pool is exhausted.
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPool_tryAlloc (memPool_handle_t* ptrHandle, uint8_t** ptr2Slot);
+
 /**
  * mempool free routine.
  */
 memPool_error_t
 memPool_free (memPool_handle_t* ptrHandle, uint8_t* ptrSlot);
 
+/**
+ * @brief mempool bulk alloc routine.
+ *
+ * Allocates \p count slots into \p ptrArray, unlinking a whole chain from the
+ * free list at once. If \p ptrGot is NULL the allocation is all-or-nothing;
+ * otherwise it is best effort and the number of slots allocated is stored in
+ * \p ptrGot. Unused entries of \p ptrArray are cleared.
+ *
+ * @return MEM_POOL_OK if all \p count slots (best effort: at least one) were
+ *         allocated; MEM_POOL_ERROR_SPACE if not enough slots; anything else
+ *         otherwise.
+ */
+memPool_error_t
+memPool_allocBulk (memPool_handle_t* ptrHandle, uint8_t** ptrArray, uint32_t count, uint32_t* ptrGot);
+
+/**
+ * @brief mempool bulk free routine.
+ *
+ * Frees the \p count slots of \p ptrArray. Slots that were not allocated
+ * are skipped, the others are freed anyway.
+ *
+ * @return MEM_POOL_OK if all slots were freed; anything else otherwise.
+ */
+memPool_error_t
+memPool_freeBulk (memPool_handle_t* ptrHandle, uint8_t* const* ptrArray, uint32_t count);
+
+/**
+ * @brief Enable slot handles routine.
+ *
+ * Pool keeps a generation counter per slot into \p ptrGen (\p slotNumber
+ * words, no need to clear them: O(1)), bumped whenever a slot is freed, so
+ * that \ref memPool_resolve rejects stale handles. Allowed only before the
+ * first allocation (or after \ref memPool_reset: words of slots handed out
+ * before are then cleared); pool must have at most
+ * 2^\ref MEM_POOL_HANDLE_INDEX_BITS slots.
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPool_setGenerations (memPool_handle_t* ptrHandle, uint32_t* ptrGen);
+
+/**
+ * @brief mempool alloc routine (slot handle).
+ *
+ * As \ref memPool_alloc, but a slot handle (index + generation, half the size
+ * of a pointer when 32-bit) is stored into \p ptrSlotHandle; slot address is
+ * also stored into \p ptr2Slot, if not NULL. Generations are needed (see
+ * \ref memPool_setGenerations).
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPool_allocHandle (memPool_handle_t* ptrHandle, memPool_slotHandle_t* ptrSlotHandle, uint8_t** ptr2Slot);
+
+/**
+ * @brief Resolve slot handle routine (O(1)).
+ *
+ * Slot address is stored into \p ptr2Slot (NULL on error). Handles of slots
+ * freed since are stale (detected while the generation did not wrap, i.e.
+ * fewer than 2^(handle bits - index bits) reuses of the slot).
+ *
+ * @return MEM_POOL_OK if no error occurred; MEM_POOL_ERROR_SLOT_NOT_ALLOCATED
+ *         if handle is stale or invalid; anything else otherwise.
+ */
+memPool_error_t
+memPool_resolve (const memPool_handle_t* ptrHandle, memPool_slotHandle_t slotHandle, uint8_t** ptr2Slot);
+
+/**
+ * @brief mempool free routine (slot handle).
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPool_freeHandle (memPool_handle_t* ptrHandle, memPool_slotHandle_t slotHandle);
+
+/**
+ * @brief Visit mempool allocated slots routine.
+ *
+ * \p visit is called on each allocated slot, in address order. Pool must have
+ * an allocation bitmap: free bitmap words are skipped (several at once, with
+ * SSE2), set bits found with count trailing zeros. \p visit may free the slot
+ * visited (not other ones).
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPool_forEachAllocated (memPool_handle_t* ptrHandle, memPool_visit_t visit, void* ptrContext);
+
+/**
+ * @brief Release all mempool slots routine.
+ *
+ * All slots are free again in O(1) (allocation bitmap, if any, is cleared up
+ * to the slots handed out so far): pool restarts from its bump pointer, with
+ * its policies and checks, and slot handles of released slots are stale. Not
+ * for object pools (see \ref memPoolObj_deinit).
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPool_reset (memPool_handle_t* ptrHandle);
+
+/**
+ * @brief Sort mempool free list by address routine.
+ *
+ * Free slots are marked on \p ptrScratch (caller supplied, at least
+ * MEM_POOL_BITMAP_WORDS (slotNumber) words) walking the free list, then the
+ * list is rebuilt in address order in one pass over the bitmap: next
+ * allocations are dense at the low end of storage, whatever the pool order.
+ * Slots still to be cleared (\ref MEM_POOL_ZERO_DEFERRED) are not moved.
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPool_compactFreeList (memPool_handle_t* ptrHandle, uint32_t* ptrScratch);
+
+#if (defined MEM_POOL_FREE_ORDER && (MEM_POOL_FREE_ORDER == 1))
+/**
+ * @brief Set mempool free list order routine.
+ *
+ * Pools start with \ref MEM_POOL_ORDER_LIFO (O(1) free). With
+ * \ref MEM_POOL_ORDER_ADDRESS, free inserts in address order (O(number of
+ * free slots)); \ref MEM_POOL_ORDER_FIFO frees at the list tail (O(1)) and is
+ * not supported by pools with an out-of-band free list. Order can be changed
+ * only before the first allocation.
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPool_setOrder (memPool_handle_t* ptrHandle, memPool_order_t order);
+#endif /* MEM_POOL_FREE_ORDER && (MEM_POOL_FREE_ORDER == 1) */
+
+#if (defined MEM_POOL_DEBUG && (MEM_POOL_DEBUG == 1))
+/**
+ * @brief Enable mempool debug checks routine.
+ *
+ * In debug mode, every pool checks in O(1) that freed slots are inside the
+ * pool and on a slot boundary (as with a bitmap). \p debugFlags enables, for
+ * this pool, more expensive checks (O(slot size)):
+ * - \ref MEM_POOL_DEBUG_POISON: freed slots are filled with a poison pattern
+ *   (but the free list link), checked when handed out again;
+ * - \ref MEM_POOL_DEBUG_CANARY: last \ref MEM_POOL_CANARY_SIZE bytes of each
+ *   slot hold a canary, checked on free.
+ * A corrupted slot is quarantined (never handed out again) and
+ * MEM_POOL_ERROR_CORRUPTED returned; bulk routines skip it. With
+ * AddressSanitizer, free slots, canaries and slots never handed out are also
+ * poisoned (ASAN_POISON_MEMORY_REGION). Allowed only before first allocation.
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPool_setDebug (memPool_handle_t* ptrHandle, uint32_t debugFlags);
+#endif /* MEM_POOL_DEBUG && (MEM_POOL_DEBUG == 1) */
+
+#if (defined memPool_zeroize && (memPool_zeroize == 1))
+/**
+ * @brief Set mempool slot clearing policy routine.
+ *
+ * Pools start with \ref MEM_POOL_ZERO_ON_ALLOC. Policy can be changed only
+ * before the first allocation; pools with an out-of-band free list do not
+ * support \ref MEM_POOL_ZERO_DEFERRED. \p zeroBytes is used by
+ * \ref MEM_POOL_ZERO_PARTIAL only (e.g. size of a header to clear).
+ *
+ * Slots handed out for the first time (never freed) are always cleared on
+ * alloc, unless the policy is partial. With \ref MEM_POOL_ZERO_DEFERRED,
+ * freed slots are not cleared on the fast paths: alloc prefers slots already
+ * cleared by \ref memPool_zeroDirty and hands out uncleared ones otherwise
+ * (see \ref memPool_allocZeroed).
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPool_setZeroPolicy (memPool_handle_t* ptrHandle, memPool_zeroPolicy_t zeroPolicy, uint32_t zeroBytes);
+
+/**
+ * @brief mempool deferred clearing routine.
+ *
+ * Clears up to \p maxSlots freed slots waiting to be cleared
+ * (\ref MEM_POOL_ZERO_DEFERRED policy), making them available to alloc as
+ * zeroed slots; the number of slots cleared is stored in \p ptrCleared (if
+ * not NULL). Meant to be called off the latency-critical path (idle time or a
+ * housekeeping task holding the pool). Slots of at least
+ * \ref MEM_POOL_ZERO_STREAM_MIN bytes are cleared with non-temporal stores
+ * (if supported), not to evict the working set from cache.
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPool_zeroDirty (memPool_handle_t* ptrHandle, uint32_t maxSlots, uint32_t* ptrCleared);
+#endif /* memPool_zeroize && (memPool_zeroize == 1) */
+
+#if (defined MEM_POOL_STATS && (MEM_POOL_STATS == 1))
+/**
+ * @brief mempool statistics snapshot routine.
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPool_getStats (const memPool_handle_t* ptrHandle, memPool_stats_t* ptrStats);
+#endif /* MEM_POOL_STATS && (MEM_POOL_STATS == 1) */
+
 /* ************************************************************************** *
  *                       End of global function section                       *
  * ************************************************************************** */
 
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
 /* ************************************************************************** */
 #endif /* MEM_POOL_H__ */
 /* ************************************************************************** */
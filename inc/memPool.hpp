@@ -0,0 +1,324 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2021 Alessandro Morniroli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file   memPool.hpp
+ * @author Alessandro Morniroli <alessandro.morniroli@gmail.com>
+ * @date   Sun Oct 18 2026
+ *
+ * @brief  Header-only C++ (C++17) wrapper interface.
+ *
+ * memPool::Pool is a typed pool with compile-time storage (slot stride and
+ * alignment are constexpr), handing out objects through std::unique_ptr.
+ * memPool::Resource is a std::pmr::memory_resource drawing small blocks (e.g.
+ * std::list, std::map nodes) from a pool.
+ */
+
+/* ************************************************************************** */
+#ifndef MEM_POOL_HPP__
+#define MEM_POOL_HPP__
+/* ************************************************************************** */
+
+/* ************************************************************************** *
+ *                         Start of includes section                          *
+ * ************************************************************************** */
+
+/* Standard C++. */
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <utility>
+/* Module include. */
+#include "memPool.h"
+
+/* ************************************************************************** *
+ *                          End of includes section                           *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                    Start of global definitions section                     *
+ * ************************************************************************** */
+
+namespace memPool
+{
+
+/**
+ * @brief Typed memory pool of \p N slots, each aligned to \p Align.
+ *
+ * Storage and allocation bitmap (O(1) double free detection) live inside the
+ * object: no slot size is carried around at runtime by the caller. Not
+ * thread-safe, not copyable nor movable (slots point into it).
+ */
+template <typename T, std::size_t N, std::size_t Align = alignof (T)>
+class Pool
+{
+public:
+    /** Slot alignment (at least a pointer one: free list is intrusive). */
+    static constexpr std::size_t slotAlign = (Align > alignof (std::uint8_t*)) ? Align : alignof (std::uint8_t*);
+
+    /** Slot stride (object size rounded up to alignment, at least a pointer). */
+    static constexpr std::size_t slotStride =
+        MEM_POOL_ALIGNED_STRIDE (((sizeof (T) > sizeof (std::uint8_t*)) ? sizeof (T) : sizeof (std::uint8_t*)),
+                                 slotAlign);
+
+    /** Number of slots. */
+    static constexpr std::size_t slotNumber = N;
+
+    static_assert ((slotAlign & (slotAlign - 1U)) == 0U, "alignment must be a power of two");
+    static_assert (slotAlign >= alignof (T), "alignment must suit T");
+    static_assert ((N != 0U) && ((slotStride * N) <= UINT32_MAX), "slot number out of range");
+
+    /** unique_ptr deleter: destroys the object and gives the slot back. */
+    struct Deleter
+    {
+        Pool* ptrPool; /**< Pool the object comes from. */
+
+        void
+        operator() (T* ptr) const noexcept
+        {
+            ptrPool->destroy (ptr);
+        }
+    };
+
+    /** Owning pointer to an object of the pool. */
+    using Ptr = std::unique_ptr<T, Deleter>;
+
+    Pool () noexcept
+    {
+        (void) memPool_initBitmap (&handle, storage, bitmap, static_cast<std::uint32_t> (slotStride),
+                                   static_cast<std::uint32_t> (N));
+    }
+
+    Pool (const Pool&)            = delete;
+    Pool& operator= (const Pool&) = delete;
+
+    /**
+     * @brief Allocate an uninitialized slot.
+     *
+     * @return Slot; nullptr if pool is exhausted.
+     */
+    T*
+    allocate () noexcept
+    {
+        std::uint8_t* ptrSlot;
+
+        /* Exhausted pool is no error here (not asserted). */
+        return (memPool_tryAlloc (&handle, &ptrSlot) == MEM_POOL_OK) ? reinterpret_cast<T*> (ptrSlot) : nullptr;
+    }
+
+    /**
+     * @brief Give back a slot (object already destroyed).
+     *
+     * @return true if slot was allocated from this pool; false otherwise.
+     */
+    bool
+    deallocate (T* ptr) noexcept
+    {
+        return memPool_free (&handle, reinterpret_cast<std::uint8_t*> (ptr)) == MEM_POOL_OK;
+    }
+
+    /**
+     * @brief Allocate a slot and construct an object into it.
+     *
+     * If the constructor throws, slot is given back.
+     *
+     * @return Object; nullptr if pool is exhausted.
+     */
+    template <typename... Args>
+    T*
+    construct (Args&&... args)
+    {
+        Guard guard{this, allocate ()};
+        T*    ptr;
+
+        ptr = (guard.ptr != nullptr) ? ::new (static_cast<void*> (guard.ptr)) T (std::forward<Args> (args)...)
+                                     : nullptr;
+
+        /* Constructed: keep the slot. */
+        guard.ptr = nullptr;
+
+        return ptr;
+    }
+
+    /**
+     * @brief Destroy an object and give back its slot (nullptr is ignored).
+     */
+    void
+    destroy (T* ptr) noexcept
+    {
+        if (ptr != nullptr)
+        {
+            ptr->~T ();
+            (void) deallocate (ptr);
+        }
+    }
+
+    /**
+     * @brief Construct an object owned by a unique_ptr (slot is given back
+     *        when the pointer is reset).
+     *
+     * @return Owning pointer; empty if pool is exhausted.
+     */
+    template <typename... Args>
+    Ptr
+    make (Args&&... args)
+    {
+        return Ptr (construct (std::forward<Args> (args)...), Deleter{this});
+    }
+
+    /**
+     * @brief Check whether \p ptr points inside the pool storage.
+     */
+    bool
+    owns (const void* ptr) const noexcept
+    {
+        /* Offset wraps if below storage. */
+        return (reinterpret_cast<std::uintptr_t> (ptr) - reinterpret_cast<std::uintptr_t> (storage)) < sizeof (storage);
+    }
+
+    /**
+     * @brief Underlying C pool handle (e.g. statistics, zeroize policy).
+     */
+    memPool_handle_t*
+    native () noexcept
+    {
+        return &handle;
+    }
+
+private:
+    /** Gives the slot back unless released (exception safety). */
+    struct Guard
+    {
+        Pool* ptrPool;
+        T*    ptr;
+
+        ~Guard ()
+        {
+            if (ptr != nullptr)
+            {
+                (void) ptrPool->deallocate (ptr);
+            }
+        }
+    };
+
+    alignas (slotAlign) std::uint8_t storage[slotStride * N]; /**< Slots.              */
+    std::uint32_t    bitmap[MEM_POOL_BITMAP_WORDS (N)];       /**< Allocation bitmap.  */
+    memPool_handle_t handle;                                  /**< C pool handle.      */
+};
+
+/**
+ * Raw block of \p Size bytes (slot type of a \ref Resource pool).
+ */
+template <std::size_t Size>
+struct Block
+{
+    unsigned char bytes[Size]; /**< Block bytes. */
+};
+
+/**
+ * @brief Memory resource serving blocks up to \p BlockSize bytes (alignment up
+ *        to \p Align) from a pool of \p N slots.
+ *
+ * Larger or over-aligned requests, and requests made once the pool is
+ * exhausted, go to the upstream resource (the default resource if none). Use
+ * it with std::pmr containers, or through \ref Allocator:
+ *
+ * @code
+ * memPool::Resource<64U, 1024U> resource;
+ * std::pmr::list<int>           list{&resource};
+ * @endcode
+ */
+template <std::size_t BlockSize, std::size_t N, std::size_t Align = alignof (std::max_align_t)>
+class Resource : public std::pmr::memory_resource
+{
+public:
+    explicit Resource (std::pmr::memory_resource* ptrFallback = std::pmr::get_default_resource ()) noexcept
+        : ptrUpstream (ptrFallback)
+    {
+    }
+
+    Resource (const Resource&)            = delete;
+    Resource& operator= (const Resource&) = delete;
+
+    /**
+     * @brief Underlying pool (e.g. to check ownership or statistics).
+     */
+    Pool<Block<BlockSize>, N, Align>&
+    pool () noexcept
+    {
+        return slots;
+    }
+
+private:
+    void*
+    do_allocate (std::size_t bytes, std::size_t alignment) override
+    {
+        void* ptr;
+
+        /* Fits a slot? Spill to upstream otherwise (or if pool exhausted). */
+        ptr = ((bytes <= BlockSize) && (alignment <= slots.slotAlign)) ? slots.allocate () : nullptr;
+
+        return (ptr != nullptr) ? ptr : ptrUpstream->allocate (bytes, alignment);
+    }
+
+    void
+    do_deallocate (void* ptr, std::size_t bytes, std::size_t alignment) override
+    {
+        if (slots.owns (ptr))
+        {
+            (void) slots.deallocate (static_cast<Block<BlockSize>*> (ptr));
+        }
+        else
+        {
+            ptrUpstream->deallocate (ptr, bytes, alignment);
+        }
+    }
+
+    bool
+    do_is_equal (const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+
+    Pool<Block<BlockSize>, N, Align> slots;       /**< Block pool.         */
+    std::pmr::memory_resource*       ptrUpstream; /**< Fallback resource.  */
+};
+
+/**
+ * Allocator drawing from a \ref Resource (drop-in for node-based containers,
+ * e.g. std::map<K, V, std::less<K>, memPool::Allocator<std::pair<const K, V>>>).
+ */
+template <typename T>
+using Allocator = std::pmr::polymorphic_allocator<T>;
+
+} /* namespace memPool */
+
+/* ************************************************************************** *
+ *                     End of global definitions section                      *
+ * ************************************************************************** */
+
+/* ************************************************************************** */
+#endif /* MEM_POOL_HPP__ */
+/* ************************************************************************** */
@@ -0,0 +1,197 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2021 Alessandro Morniroli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file   memPoolGrow.h
+ * @author Alessandro Morniroli <alessandro.morniroli@gmail.com>
+ * @date   Sun Oct 18 2026
+ *
+ * @brief  Growable memory pool (chained storage chunks) interface.
+ *
+ * Storage is supplied in chunks, at any time (\ref memPoolGrow_addChunk) or on
+ * demand through a chunk provider callback. Slots of a new chunk are handed
+ * out by a bump pointer (no linking at add time); fully free chunks can be
+ * handed back by \ref memPoolGrow_shrink.
+ *
+ * Chunks are aligned on MEM_POOL_GROW_CHUNK_ALIGN and at most that large:
+ * the chunk of a slot is found in O(1) by masking the slot address. Unless
+ * MEM_POOL_UNCHECKED_FREE, every chunk keeps an allocation bitmap (between
+ * its header and its slots): double frees are caught in O(1) too.
+ */
+
+/* ************************************************************************** */
+#ifndef MEM_POOL_GROW_H__
+#define MEM_POOL_GROW_H__
+/* ************************************************************************** */
+
+/* ************************************************************************** *
+ *                         Start of includes section                          *
+ * ************************************************************************** */
+
+/* Standard C. */
+#include <stdint.h>
+/* Module include. */
+#include "memPool.h"
+
+/* ************************************************************************** *
+ *                          End of includes section                           *
+ * ************************************************************************** */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ************************************************************************** *
+ *                    Start of global definitions section                     *
+ * ************************************************************************** */
+
+/**
+ * Chunk provider callback: returns a new chunk (storing its size into
+ * \p ptrSize), NULL if no more storage.
+ */
+typedef uint8_t* (*memPoolGrow_provider_t) (void* ptrContext, uint32_t* ptrSize);
+
+/**
+ * Chunk release callback: a fully free chunk is handed back.
+ */
+typedef void (*memPoolGrow_release_t) (void* ptrContext, uint8_t* ptrChunk, uint32_t size);
+
+/**
+ * Chunk header (stored at the beginning of the chunk itself).
+ */
+typedef struct memPoolGrow_chunk_s
+{
+    struct memPoolGrow_chunk_s* ptrNext;    /**< Next chunk.                              */
+    const void*                 ptrOwner;   /**< Handle of the pool owning the chunk.     */
+    uint8_t*                    ptrSlots;   /**< First slot.                              */
+    uint32_t*                   ptrBitmap;  /**< Allocation bitmap (NULL if unchecked).   */
+    uint32_t                    size;       /**< Chunk size (bytes, header included).     */
+    uint32_t                    slotNumber; /**< Number of slots of the chunk.            */
+    uint32_t                    bumpIndex;  /**< Index of first slot never handed out.    */
+    uint32_t                    freeCount;  /**< Free slots (computed while shrinking).   */
+} memPoolGrow_chunk_t;
+
+/**
+ * Growable memory pool handle.
+ */
+typedef struct
+{
+    uint8_t*               ptrHead;      /**< Pointer to next available slot.          */
+    memPoolGrow_chunk_t*   ptrChunks;    /**< Chunks (most recently added first).      */
+    memPoolGrow_chunk_t*   ptrBumpChunk; /**< Chunk slots are bumped from.             */
+    memPoolGrow_provider_t provider;     /**< Chunk provider (NULL if none).           */
+    memPoolGrow_release_t  release;      /**< Chunk release (NULL if none).            */
+    void*                  ptrContext;   /**< Callbacks context.                       */
+    uint32_t               slotSize;     /**< Single slot size (bytes).                */
+} memPoolGrow_handle_t;
+
+/* ************************************************************************** *
+ *                     End of global definitions section                      *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                     Start of global variables section                      *
+ * ************************************************************************** */
+
+/* ************************************************************************** *
+ *                      End of global variables section                       *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                      Start of global function section                      *
+ * ************************************************************************** */
+
+/**
+ * @brief Initialize growable mempool routine (no storage yet).
+ *
+ * \p provider and \p release are optional.
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPoolGrow_init (memPoolGrow_handle_t*  ptrHandle,
+                  uint32_t               slotSize,
+                  memPoolGrow_provider_t provider,
+                  memPoolGrow_release_t  release,
+                  void*                  ptrContext);
+
+/**
+ * @brief Add a storage chunk routine (O(1), slots are not linked).
+ *
+ * Chunk header (and bitmap) is stored at the beginning of \p ptrChunk, which
+ * must be aligned on MEM_POOL_GROW_CHUNK_ALIGN, at most that large and large
+ * enough to hold at least one slot.
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPoolGrow_addChunk (memPoolGrow_handle_t* ptrHandle, uint8_t* ptrChunk, uint32_t size);
+
+/**
+ * @brief Growable mempool alloc routine.
+ *
+ * Free list first, then bump pointer of chunks, then chunk provider. A
+ * chunk from the provider too small, too large or misaligned is handed back
+ * to the release callback (if any).
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPoolGrow_alloc (memPoolGrow_handle_t* ptrHandle, uint8_t** ptr2Slot);
+
+/**
+ * @brief Growable mempool free routine.
+ *
+ * Slot must lie on a slot boundary of a chunk and have been handed out (and,
+ * unless MEM_POOL_UNCHECKED_FREE, not be freed already).
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPoolGrow_free (memPoolGrow_handle_t* ptrHandle, uint8_t* ptrSlot);
+
+/**
+ * @brief Growable mempool shrink routine.
+ *
+ * Chunks whose slots are all free are unlinked and handed to the release
+ * callback; their number is stored into \p ptrReleased (if not NULL). Cost
+ * is O(free slots + chunks): meant to be called seldom, off the hot path.
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPoolGrow_shrink (memPoolGrow_handle_t* ptrHandle, uint32_t* ptrReleased);
+
+/* ************************************************************************** *
+ *                       End of global function section                       *
+ * ************************************************************************** */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+/* ************************************************************************** */
+#endif /* MEM_POOL_GROW_H__ */
+/* ************************************************************************** */
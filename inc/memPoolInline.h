@@ -0,0 +1,268 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2021 Alessandro Morniroli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file   memPoolInline.h
+ * @author Alessandro Morniroli <alessandro.morniroli@gmail.com>
+ * @date   Sun Oct 18 2026
+ *
+ * @brief  Memory pool inline fast path (header only).
+ *
+ * Pools defined by \ref MEM_POOL_INLINE_DEFINE have compile-time slot size
+ * and number: their static inline routines compile down to a free list pop
+ * or push (stride is a constant). Plain pools only: no bitmap, out-of-band
+ * list, handles, policies or statistics (see memPool.h for those).
+ */
+
+/* ************************************************************************** */
+#ifndef MEM_POOL_INLINE_H__
+#define MEM_POOL_INLINE_H__
+/* ************************************************************************** */
+
+/* ************************************************************************** *
+ *                         Start of includes section                          *
+ * ************************************************************************** */
+
+/* Standard C. */
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+/* Module include. */
+#include "memPool_conf.h"
+#include "memPool.h"
+
+/* ************************************************************************** *
+ *                          End of includes section                           *
+ * ************************************************************************** */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* ************************************************************************** *
+ *                    Start of global definitions section                     *
+ * ************************************************************************** */
+
+/**
+ * Inline pools check freed slots (range & slot boundary) unless disabled,
+ * e.g. in release builds (default: as \ref MEM_POOL_CHECK_PARAMS).
+ */
+#if (!defined MEM_POOL_INLINE_CHECKS)
+    #if (defined MEM_POOL_CHECK_PARAMS && (MEM_POOL_CHECK_PARAMS == 1))
+        #define MEM_POOL_INLINE_CHECKS 1
+    #else
+        #define MEM_POOL_INLINE_CHECKS 0
+    #endif
+#endif /* MEM_POOL_INLINE_CHECKS */
+
+/**
+ * Slot stride of an inline pool: slot size rounded up to a pointer (every
+ * slot holds an aligned link word when free).
+ */
+#define MEM_POOL_INLINE_STRIDE(slotSize) \
+    (((((uint32_t) (slotSize)) + ((uint32_t) sizeof (uintptr_t)) - 1U) / ((uint32_t) sizeof (uintptr_t))) * \
+     ((uint32_t) sizeof (uintptr_t)))
+
+/**
+ * Define inline pool \p name (file scope): \p slotNumber slots of
+ * \p slotSize bytes, storage included (zero initialized: ready to use), with
+ * routines name##_alloc, name##_free and name##_reset.
+ */
+#define MEM_POOL_INLINE_DEFINE(name, slotSize, slotNumber)                                                       \
+    static uintptr_t name##Storage[(MEM_POOL_INLINE_STRIDE (slotSize) / sizeof (uintptr_t)) * (slotNumber)];    \
+    static memPoolInline_handle_t name = { NULL, ((uint8_t*) name##Storage), 0U };                              \
+                                                                                                                 \
+    static inline memPool_error_t                                                                                \
+    name##_alloc (uint8_t** ptr2Slot)                                                                            \
+    {                                                                                                            \
+        return memPoolInline_alloc (&name, MEM_POOL_INLINE_STRIDE (slotSize), (slotNumber), ptr2Slot);           \
+    }                                                                                                            \
+                                                                                                                 \
+    static inline memPool_error_t                                                                                \
+    name##_free (uint8_t* ptrSlot)                                                                               \
+    {                                                                                                            \
+        return memPoolInline_free (&name, MEM_POOL_INLINE_STRIDE (slotSize), ptrSlot);                           \
+    }                                                                                                            \
+                                                                                                                 \
+    static inline void                                                                                           \
+    name##_reset (void)                                                                                          \
+    {                                                                                                            \
+        memPoolInline_reset (&name);                                                                             \
+    }
+
+/**
+ * Inline memory pool handle.
+ */
+typedef struct
+{
+    uint8_t* ptrHead;    /**< Pointer to next available slot.        */
+    uint8_t* ptrStorage; /**< Pointer to first slot.                 */
+    uint32_t bumpIndex;  /**< Index of first slot never handed out.  */
+} memPoolInline_handle_t;
+
+/* ************************************************************************** *
+ *                     End of global definitions section                      *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                     Start of global variables section                      *
+ * ************************************************************************** */
+
+/* ************************************************************************** *
+ *                      End of global variables section                       *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                      Start of global function section                      *
+ * ************************************************************************** */
+
+/**
+ * @brief Inline mempool alloc routine.
+ *
+ * Slot is popped from the free list, or taken from the bump pointer (slots
+ * never handed out); \p slotSize (stride) and \p slotNumber are meant to be
+ * constants (see \ref MEM_POOL_INLINE_DEFINE). Slot is cleared as
+ * \ref memPool_zeroize requires.
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+static inline memPool_error_t
+memPoolInline_alloc (memPoolInline_handle_t* ptrHandle, uint32_t slotSize, uint32_t slotNumber, uint8_t** ptr2Slot)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrHandle != NULL) && (ptr2Slot != NULL));
+
+    /* Free list not empty? */
+    if (ptrHandle->ptrHead != NULL)
+    {
+        /* Pop head. */
+        *ptr2Slot          = ptrHandle->ptrHead;
+        ptrHandle->ptrHead = *((uint8_t**) ptrHandle->ptrHead);
+
+        /* Succeed! */
+        ret = MEM_POOL_OK;
+    }
+    /* Slots never handed out left? */
+    else if (ptrHandle->bumpIndex < slotNumber)
+    {
+        /* Take slot from bump pointer. */
+        *ptr2Slot = &ptrHandle->ptrStorage[(ptrHandle->bumpIndex * slotSize)];
+        ptrHandle->bumpIndex++;
+
+        /* Succeed! */
+        ret = MEM_POOL_OK;
+    }
+    else
+    {
+        /* Clear pointer. */
+        *ptr2Slot = NULL;
+
+        /* Error! No free slots! */
+        ret = MEM_POOL_ERROR_SPACE;
+    }
+
+#if (defined memPool_zeroize && (memPool_zeroize == 1))
+    if (ret == MEM_POOL_OK)
+    {
+        /* Zeroise the slot (as calloc). */
+        (void) memset (*ptr2Slot, 0x00, slotSize);
+    }
+#endif /* memPool_zeroize && (memPool_zeroize == 1) */
+
+    /* Return the function result code. */
+    return ret;
+}
+
+/**
+ * @brief Inline mempool free routine.
+ *
+ * Slot is pushed on the free list. If \ref MEM_POOL_INLINE_CHECKS is enabled,
+ * slot must have been handed out and be on a slot boundary (O(1), double free
+ * is not detected).
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+static inline memPool_error_t
+memPoolInline_free (memPoolInline_handle_t* ptrHandle, uint32_t slotSize, uint8_t* ptrSlot)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrHandle != NULL) && (ptrSlot != NULL));
+
+#if (MEM_POOL_INLINE_CHECKS == 1)
+    /* Outside slots handed out (wraps if below storage) or not on a slot boundary? */
+    if (((((uintptr_t) ptrSlot) - ((uintptr_t) ptrHandle->ptrStorage)) >=
+         (((uintptr_t) slotSize) * ptrHandle->bumpIndex))                      ||
+        (((((uintptr_t) ptrSlot) - ((uintptr_t) ptrHandle->ptrStorage)) % slotSize) != 0U))
+    {
+        /* Error! Slot was not allocated! */
+        ret = MEM_POOL_ERROR_SLOT_NOT_ALLOCATED;
+    }
+    else
+#else
+    (void) slotSize;
+#endif /* MEM_POOL_INLINE_CHECKS == 1 */
+    {
+        /* Set item freed to point to current head of the list. */
+        *((uint8_t**) ptrSlot) = ptrHandle->ptrHead;
+
+        /* Slot freed is the new head. */
+        ptrHandle->ptrHead = ptrSlot;
+
+        /* Succeed! */
+        ret = MEM_POOL_OK;
+    }
+
+    /* Return the function result code. */
+    return ret;
+}
+
+/**
+ * @brief Inline mempool release all slots routine (O(1)).
+ */
+static inline void
+memPoolInline_reset (memPoolInline_handle_t* ptrHandle)
+{
+    /* Assert block (if defined). */
+    memPool_assert (ptrHandle != NULL);
+
+    /* Empty list: all slots handed out by the bump pointer again. */
+    ptrHandle->ptrHead   = NULL;
+    ptrHandle->bumpIndex = 0U;
+}
+
+/* ************************************************************************** *
+ *                       End of global function section                       *
+ * ************************************************************************** */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+/* ************************************************************************** */
+#endif /* MEM_POOL_INLINE_H__ */
+/* ************************************************************************** */
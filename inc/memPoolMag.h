@@ -0,0 +1,144 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2021 Alessandro Morniroli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file   memPoolMag.h
+ * @author Alessandro Morniroli <alessandro.morniroli@gmail.com>
+ * @date   Sun Oct 18 2026
+ *
+ * @brief  Per-thread slot cache (magazine) interface.
+ *
+ * A magazine is a small thread owned stack of slots in front of a shared
+ * lock-free pool: alloc/free touch only the magazine, which is refilled or
+ * flushed in batches against the pool. Enabled by \ref MEM_POOL_MAGAZINE_SIZE.
+ *
+ * Cached slots are marked free in the pool allocation bitmap (one atomic bit
+ * update per alloc / free): a slot freed twice, or never allocated, is
+ * rejected (MEM_POOL_ERROR_SLOT_NOT_ALLOCATED) as by the pool.
+ */
+
+/* ************************************************************************** */
+#ifndef MEM_POOL_MAG_H__
+#define MEM_POOL_MAG_H__
+/* ************************************************************************** */
+
+/* ************************************************************************** *
+ *                         Start of includes section                          *
+ * ************************************************************************** */
+
+/* Standard C. */
+#include <stdint.h>
+/* Module include. */
+#include "memPool_conf.h"
+#include "memPoolMt.h"
+
+/* ************************************************************************** *
+ *                          End of includes section                           *
+ * ************************************************************************** */
+
+#if (defined MEM_POOL_MAGAZINE_SIZE && (MEM_POOL_MAGAZINE_SIZE > 0))
+
+/* ************************************************************************** *
+ *                    Start of global definitions section                     *
+ * ************************************************************************** */
+
+/**
+ * Per-thread magazine (must be owned by a single thread).
+ */
+typedef struct memPoolMag_s
+{
+    memPoolMt_handle_t*  ptrPool;                        /**< Shared pool.                  */
+    struct memPoolMag_s* ptrNext;                        /**< Next magazine of same thread. */
+    uint32_t             count;                          /**< Number of cached slots.       */
+    uint8_t*             slots[MEM_POOL_MAGAZINE_SIZE];  /**< Cached slots (stack).         */
+} memPoolMag_t;
+
+/* ************************************************************************** *
+ *                     End of global definitions section                      *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                     Start of global variables section                      *
+ * ************************************************************************** */
+
+/* ************************************************************************** *
+ *                      End of global variables section                       *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                      Start of global function section                      *
+ * ************************************************************************** */
+
+/**
+ * @brief Initialize magazine routine.
+ *
+ * Must be called by the owning thread: magazine is registered so that its
+ * cached slots are handed back to the pool when the thread exits. Magazine
+ * must then stay valid for the thread lifetime (e.g. _Thread_local or static),
+ * unless \ref memPoolMag_deinit is called first.
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPoolMag_init (memPoolMag_t* ptrMag, memPoolMt_handle_t* ptrPool);
+
+/**
+ * @brief Deinitialize magazine routine.
+ *
+ * Must be called by the owning thread: cached slots are handed back to the
+ * pool and magazine is unregistered.
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPoolMag_deinit (memPoolMag_t* ptrMag);
+
+/**
+ * @brief Magazine alloc routine (refills half magazine from pool if empty).
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPoolMag_alloc (memPoolMag_t* ptrMag, uint8_t** ptr2Slot);
+
+/**
+ * @brief Magazine free routine (flushes half magazine to pool if full).
+ *
+ * Slots are checked against the pool (\ref MEM_POOL_ERROR_SLOT_NOT_ALLOCATED)
+ * only once flushed.
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPoolMag_free (memPoolMag_t* ptrMag, uint8_t* ptrSlot);
+
+/* ************************************************************************** *
+ *                       End of global function section                       *
+ * ************************************************************************** */
+
+#endif /* MEM_POOL_MAGAZINE_SIZE && (MEM_POOL_MAGAZINE_SIZE > 0) */
+
+/* ************************************************************************** */
+#endif /* MEM_POOL_MAG_H__ */
+/* ************************************************************************** */
@@ -0,0 +1,181 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2021 Alessandro Morniroli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file   memPoolMap.h
+ * @author Alessandro Morniroli <alessandro.morniroli@gmail.com>
+ * @date   Sun Oct 18 2026
+ *
+ * @brief  mmap backed pool storage (Linux) interface.
+ *
+ * Pool storage is reserved with mmap (lazily populated, optionally on huge
+ * pages) and optionally bound to a NUMA node. A node set keeps a lock-free
+ * pool per NUMA node, so that threads allocate node local memory. Enabled by
+ * \ref MEM_POOL_MAP_NODES.
+ */
+
+/* ************************************************************************** */
+#ifndef MEM_POOL_MAP_H__
+#define MEM_POOL_MAP_H__
+/* ************************************************************************** */
+
+/* ************************************************************************** *
+ *                         Start of includes section                          *
+ * ************************************************************************** */
+
+/* Standard C. */
+#include <stddef.h>
+#include <stdint.h>
+/* Module include. */
+#include "memPool_conf.h"
+#include "memPoolMt.h"
+
+/* ************************************************************************** *
+ *                          End of includes section                           *
+ * ************************************************************************** */
+
+#if (defined MEM_POOL_MAP_NODES && (MEM_POOL_MAP_NODES > 0))
+
+
+/* ************************************************************************** *
+ *                    Start of global definitions section                     *
+ * ************************************************************************** */
+
+/**
+ * Storage reservation flags.
+ */
+#define MEM_POOL_MAP_FLAG_NONE     0x00U /**< Regular pages, populated on first touch.         */
+#define MEM_POOL_MAP_FLAG_HUGETLB  0x01U /**< Explicit huge pages (THP if none reserved).      */
+#define MEM_POOL_MAP_FLAG_THP      0x02U /**< Transparent huge pages (madvise).                */
+#define MEM_POOL_MAP_FLAG_POPULATE 0x04U /**< Populate (prefault) whole storage up front.      */
+
+/**
+ * No NUMA node binding.
+ */
+#define MEM_POOL_MAP_NO_NODE (-1)
+
+/**
+ * Per NUMA node pool set handle.
+ */
+typedef struct
+{
+    memPoolMt_handle_t pools[MEM_POOL_MAP_NODES];      /**< Lock-free pool of each node.  */
+    uint8_t*           ptrStorage[MEM_POOL_MAP_NODES]; /**< Storage of each node.         */
+    size_t             mapped[MEM_POOL_MAP_NODES];     /**< Mapped size of each node.     */
+    uint32_t           nodeNumber;                     /**< Number of nodes in use.       */
+} memPoolMap_nodeSet_t;
+
+/* ************************************************************************** *
+ *                     End of global definitions section                      *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                     Start of global variables section                      *
+ * ************************************************************************** */
+
+/* ************************************************************************** *
+ *                      End of global variables section                       *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                      Start of global function section                      *
+ * ************************************************************************** */
+
+/**
+ * @brief Reserve pool storage routine.
+ *
+ * At least \p size bytes are mapped (rounded up to page, or huge page, size),
+ * the actual size is stored into \p ptrMapped. Pages are populated on first
+ * touch unless \ref MEM_POOL_MAP_FLAG_POPULATE is given (then after huge page
+ * advice and node binding, so prefaulted pages follow both). If \p node is not
+ * \ref MEM_POOL_MAP_NO_NODE, storage is bound to that NUMA node (mbind; left
+ * unbound if the kernel has no NUMA support).
+ *
+ * @return MEM_POOL_OK if no error occurred; MEM_POOL_ERROR_SPACE if mapping
+ *         failed; anything else otherwise.
+ */
+memPool_error_t
+memPoolMap_reserve (uint8_t** ptr2Storage, size_t size, uint32_t flags, int32_t node, size_t* ptrMapped);
+
+/**
+ * @brief Release pool storage routine.
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPoolMap_release (uint8_t* ptrStorage, size_t mapped);
+
+/**
+ * @brief Initialize per NUMA node pool set routine.
+ *
+ * \p nodeNumber (at most \ref MEM_POOL_MAP_NODES) pools of \p slotNumber slots
+ * each are reserved, pool i bound to node i (with an allocation bitmap).
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPoolMap_nodeSetInit (memPoolMap_nodeSet_t* ptrSet,
+                        uint32_t              slotSize,
+                        uint32_t              slotNumber,
+                        uint32_t              nodeNumber,
+                        uint32_t              flags);
+
+/**
+ * @brief Deinitialize per NUMA node pool set routine (storage released).
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPoolMap_nodeSetDeinit (memPoolMap_nodeSet_t* ptrSet);
+
+/**
+ * @brief Per NUMA node pool set alloc routine (thread-safe).
+ *
+ * Slot is allocated from the pool of the node the calling thread runs on;
+ * from the other nodes if that one is exhausted.
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPoolMap_nodeSetAlloc (memPoolMap_nodeSet_t* ptrSet, uint8_t** ptr2Slot);
+
+/**
+ * @brief Per NUMA node pool set free routine (thread-safe).
+ *
+ * Slot goes back to the pool it was allocated from (found by address).
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPoolMap_nodeSetFree (memPoolMap_nodeSet_t* ptrSet, uint8_t* ptrSlot);
+
+/* ************************************************************************** *
+ *                       End of global function section                       *
+ * ************************************************************************** */
+
+#endif /* defined MEM_POOL_MAP_NODES && (MEM_POOL_MAP_NODES > 0) */
+
+/* ************************************************************************** */
+#endif /* MEM_POOL_MAP_H__ */
+/* ************************************************************************** */
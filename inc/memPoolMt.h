@@ -0,0 +1,220 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2021 Alessandro Morniroli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file   memPoolMt.h
+ * @author Alessandro Morniroli <alessandro.morniroli@gmail.com>
+ * @date   Sun Oct 18 2026
+ *
+ * @brief  Lock-free (thread-safe) static memory pool utility interface.
+ */
+
+/* ************************************************************************** */
+#ifndef MEM_POOL_MT_H__
+#define MEM_POOL_MT_H__
+/* ************************************************************************** */
+
+/* ************************************************************************** *
+ *                         Start of includes section                          *
+ * ************************************************************************** */
+
+/* Standard C. */
+#include <stdatomic.h>
+#include <stdint.h>
+/* Module include. */
+#include "memPool.h"
+
+/* ************************************************************************** *
+ *                          End of includes section                           *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                    Start of global definitions section                     *
+ * ************************************************************************** */
+
+/**
+ * Cache line size (bytes), to keep data updated by different threads apart.
+ */
+#define MEM_POOL_CACHE_LINE 64U
+
+#if (defined MEM_POOL_STATS && (MEM_POOL_STATS == 1))
+/**
+ * Lock-free pool statistics shard (updated by a subset of threads).
+ */
+typedef struct
+{
+    _Alignas (MEM_POOL_CACHE_LINE) _Atomic uint64_t allocs; /**< Slots allocated.       */
+    _Atomic uint64_t frees;                                 /**< Slots freed.           */
+    _Atomic uint64_t allocFailures;                         /**< Allocations failed.    */
+    _Atomic uint64_t freeFailures;                          /**< Frees failed.          */
+} memPoolMt_statsShard_t;
+
+/**
+ * Lock-free pool occupancy (a peak is not the sum of per shard peaks: shared).
+ */
+typedef struct
+{
+    _Alignas (MEM_POOL_CACHE_LINE) _Atomic uint32_t inUse; /**< Slots in use.            */
+    _Atomic uint32_t highWater;                            /**< Peak of slots in use.    */
+} memPoolMt_statsUse_t;
+#endif /* MEM_POOL_STATS && (MEM_POOL_STATS == 1) */
+
+/**
+ * Lock-free memory pool handle.
+ *
+ * Free list is a Treiber stack: head packs the index of the top slot (plus
+ * one, zero meaning empty) in the low 32 bits and a generation tag in the
+ * high 32 bits. Tag is bumped by every successful update, so that a stale
+ * head (ABA) makes the compare-and-swap fail.
+ */
+typedef struct
+{
+    _Atomic uint64_t  head;       /**< Tagged free list head.                 */
+    _Atomic uint32_t  bumpIndex;  /**< Index of first slot never handed out.  */
+    uint8_t*          ptrStorage; /**< Pointer to first slot.                 */
+    _Atomic uint32_t* ptrBitmap;  /**< Allocation bitmap.                     */
+    uint32_t          slotSize;   /**< Single slot size (bytes).              */
+    uint32_t          slotNumber; /**< Total number of slots.                 */
+#if (defined MEM_POOL_STATS && (MEM_POOL_STATS == 1))
+    memPoolMt_statsShard_t stats[MEM_POOL_STATS_SHARDS]; /**< Statistics shards. */
+    memPoolMt_statsUse_t   use;                          /**< Slots in use & peak.  */
+#endif /* MEM_POOL_STATS && (MEM_POOL_STATS == 1) */
+} memPoolMt_handle_t;
+
+/* ************************************************************************** *
+ *                     End of global definitions section                      *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                     Start of global variables section                      *
+ * ************************************************************************** */
+
+/* ************************************************************************** *
+ *                      End of global variables section                       *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                      Start of global function section                      *
+ * ************************************************************************** */
+
+/**
+ * @brief Initialize lock-free mempool routine.
+ *
+ * Not thread-safe: pool must not be used by other threads while initialized.
+ * \p slotSize must be a multiple of 4 bytes and \p ptrStorage 4 bytes aligned
+ * (free list links are 32-bit slot indexes). \p ptrBitmap (\ref
+ * MEM_POOL_BITMAP_WORDS words) is mandatory: \ref memPoolMt_free detects a
+ * slot that was not allocated (double free) in constant time, which would
+ * otherwise corrupt the lock-free free list.
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPoolMt_init (memPoolMt_handle_t* ptrHandle,
+                uint8_t*            ptrStorage,
+                _Atomic uint32_t*   ptrBitmap,
+                uint32_t            slotSize,
+                uint32_t            slotNumber);
+
+/**
+ * @brief Lock-free mempool alloc routine (thread-safe).
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPoolMt_alloc (memPoolMt_handle_t* ptrHandle, uint8_t** ptr2Slot);
+
+/**
+ * @brief Lock-free mempool alloc routine, pool may be exhausted (thread-safe).
+ *
+ * As \ref memPoolMt_alloc, but \ref MEM_POOL_ERROR_SPACE is not asserted.
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPoolMt_tryAlloc (memPoolMt_handle_t* ptrHandle, uint8_t** ptr2Slot);
+
+/**
+ * @brief Lock-free mempool free routine (thread-safe).
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPoolMt_free (memPoolMt_handle_t* ptrHandle, uint8_t* ptrSlot);
+
+/**
+ * @brief Lock-free mempool bulk alloc routine (thread-safe).
+ *
+ * As \ref memPool_allocBulk: the free list chain is unlinked with a single
+ * CAS (plus one on the bump pointer if the free list runs short).
+ *
+ * @return See \ref memPool_allocBulk.
+ */
+memPool_error_t
+memPoolMt_allocBulk (memPoolMt_handle_t* ptrHandle, uint8_t** ptrArray, uint32_t count, uint32_t* ptrGot);
+
+/**
+ * @brief Lock-free mempool bulk alloc routine, slots not cleared (thread-safe).
+ *
+ * As \ref memPoolMt_allocBulk, but slots are handed out as is (free list
+ * link included): for slot caches clearing slots when they hand them out
+ * (see memPoolMag.h), so that slots never used are not cleared.
+ *
+ * @return See \ref memPool_allocBulk.
+ */
+memPool_error_t
+memPoolMt_allocBulkRaw (memPoolMt_handle_t* ptrHandle, uint8_t** ptrArray, uint32_t count, uint32_t* ptrGot);
+
+/**
+ * @brief Lock-free mempool bulk free routine (thread-safe).
+ *
+ * As \ref memPool_freeBulk: slots are linked privately and spliced on the
+ * free list with a single CAS.
+ *
+ * @return MEM_POOL_OK if all slots were freed; anything else otherwise.
+ */
+memPool_error_t
+memPoolMt_freeBulk (memPoolMt_handle_t* ptrHandle, uint8_t* const* ptrArray, uint32_t count);
+
+#if (defined MEM_POOL_STATS && (MEM_POOL_STATS == 1))
+/**
+ * @brief Lock-free mempool statistics snapshot routine (thread-safe).
+ *
+ * Shards are summed: snapshot is not atomic with respect to concurrent
+ * alloc/free calls.
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPoolMt_getStats (memPoolMt_handle_t* ptrHandle, memPool_stats_t* ptrStats);
+#endif /* MEM_POOL_STATS && (MEM_POOL_STATS == 1) */
+
+/* ************************************************************************** *
+ *                       End of global function section                       *
+ * ************************************************************************** */
+
+/* ************************************************************************** */
+#endif /* MEM_POOL_MT_H__ */
+/* ************************************************************************** */
@@ -0,0 +1,171 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2021 Alessandro Morniroli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file   memPoolObj.h
+ * @author Alessandro Morniroli <alessandro.morniroli@gmail.com>
+ * @date   Sun Oct 18 2026
+ *
+ * @brief  Object memory pool interface.
+ *
+ * Objects are constructed once, when their slot is handed out for the first
+ * time, and go back to the pool still constructed (optionally reset): warm
+ * objects are reused, no construction cost on the allocation path. The free
+ * list link lives in a word in front of each object, so object contents are
+ * never overwritten by the pool.
+ */
+
+/* ************************************************************************** */
+#ifndef MEM_POOL_OBJ_H__
+#define MEM_POOL_OBJ_H__
+/* ************************************************************************** */
+
+/* ************************************************************************** *
+ *                         Start of includes section                          *
+ * ************************************************************************** */
+
+/* Standard C. */
+#include <stdint.h>
+/* Module include. */
+#include "memPool_conf.h"
+#include "memPool.h"
+
+/* ************************************************************************** *
+ *                          End of includes section                           *
+ * ************************************************************************** */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ************************************************************************** *
+ *                    Start of global definitions section                     *
+ * ************************************************************************** */
+
+/**
+ * Slot size of an object pool whose objects are \p objectSize bytes (link
+ * word in front of the object, object size rounded up to a pointer).
+ */
+#define MEM_POOL_OBJ_SLOT_SIZE(objectSize)                                                                    \
+    (((uint32_t) sizeof (uint8_t*)) +                                                                         \
+     ((((uint32_t) (objectSize)) + ((uint32_t) sizeof (uint8_t*)) - 1U) & ~(((uint32_t) sizeof (uint8_t*)) - 1U)))
+
+/**
+ * Object hook callback (object construction, reset or destruction).
+ */
+typedef void (*memPoolObj_hook_t) (void* ptrContext, uint8_t* ptrObject);
+
+/**
+ * Object memory pool handle.
+ */
+typedef struct
+{
+    memPool_handle_t  pool;       /**< Slots (link word followed by object).   */
+    memPoolObj_hook_t construct;  /**< Run once per object (NULL if none).     */
+    memPoolObj_hook_t reset;      /**< Run on free (NULL if none).             */
+    memPoolObj_hook_t destruct;   /**< Run on deinit (NULL if none).           */
+    void*             ptrContext; /**< Hooks context.                          */
+} memPoolObj_handle_t;
+
+/* ************************************************************************** *
+ *                     End of global definitions section                      *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                     Start of global variables section                      *
+ * ************************************************************************** */
+
+/* ************************************************************************** *
+ *                      End of global variables section                       *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                      Start of global function section                      *
+ * ************************************************************************** */
+
+/**
+ * @brief Initialize object mempool routine.
+ *
+ * \p ptrStorage holds \p objectNumber slots of
+ * \ref MEM_POOL_OBJ_SLOT_SIZE (\p objectSize) bytes, pointer aligned (objects
+ * are pointer aligned too); \p ptrBitmap is optional (see
+ * \ref memPool_initBitmap). No object is constructed yet. Hooks are optional.
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPoolObj_init (memPoolObj_handle_t* ptrHandle,
+                 uint8_t*             ptrStorage,
+                 uint32_t*            ptrBitmap,
+                 uint32_t             objectSize,
+                 uint32_t             objectNumber,
+                 memPoolObj_hook_t    construct,
+                 memPoolObj_hook_t    reset,
+                 memPoolObj_hook_t    destruct,
+                 void*                ptrContext);
+
+/**
+ * @brief Object mempool alloc routine.
+ *
+ * A freed (warm) object is reused if any; otherwise a new slot is handed out
+ * and its object constructed. Objects are never zeroized.
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPoolObj_alloc (memPoolObj_handle_t* ptrHandle, uint8_t** ptr2Object);
+
+/**
+ * @brief Object mempool free routine.
+ *
+ * Object goes back to the pool still constructed, reset hook is run on it.
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPoolObj_free (memPoolObj_handle_t* ptrHandle, uint8_t* ptrObject);
+
+/**
+ * @brief Deinitialize object mempool routine.
+ *
+ * Destruct hook is run on every object ever constructed (objects should all
+ * be freed first); pool must be initialized again before being used.
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPoolObj_deinit (memPoolObj_handle_t* ptrHandle);
+
+/* ************************************************************************** *
+ *                       End of global function section                       *
+ * ************************************************************************** */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+/* ************************************************************************** */
+#endif /* MEM_POOL_OBJ_H__ */
+/* ************************************************************************** */
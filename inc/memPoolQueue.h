@@ -0,0 +1,202 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2021 Alessandro Morniroli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file   memPoolQueue.h
+ * @author Alessandro Morniroli <alessandro.morniroli@gmail.com>
+ * @date   Sun Oct 18 2026
+ *
+ * @brief  Bounded slot queue (SPSC / MPMC) over a lock-free memory pool interface.
+ *
+ * Queue carries slots of one \ref memPoolMt_handle_t pool by index (32-bit
+ * cells, no separate pointer array): a producer allocates a slot, fills it
+ * and enqueues it, a consumer dequeues it and releases it to the pool with a
+ * single call. Enqueue / dequeue work in batches: a batch costs one update
+ * of the shared position (one CAS for MPMC queues).
+ */
+
+/* ************************************************************************** */
+#ifndef MEM_POOL_QUEUE_H__
+#define MEM_POOL_QUEUE_H__
+/* ************************************************************************** */
+
+/* ************************************************************************** *
+ *                         Start of includes section                          *
+ * ************************************************************************** */
+
+/* Standard C. */
+#include <stdatomic.h>
+#include <stdint.h>
+/* Module include. */
+#include "memPool_conf.h"
+#include "memPoolMt.h"
+
+/* ************************************************************************** *
+ *                          End of includes section                           *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                    Start of global definitions section                     *
+ * ************************************************************************** */
+
+/**
+ * Queue mode.
+ */
+typedef enum
+{
+    MEM_POOL_QUEUE_SPSC = 0, /**< Single producer, single consumer (no CAS).   */
+    MEM_POOL_QUEUE_MPMC      /**< Multiple producers, multiple consumers.      */
+} memPoolQueue_mode_t;
+
+/**
+ * Queue cell: slot index and, for MPMC queues, cell sequence number (lap of
+ * the position the cell is free, or full, for).
+ */
+typedef struct
+{
+    _Atomic uint32_t seq; /**< Sequence number (MPMC only).  */
+    uint32_t         idx; /**< Pool slot index.              */
+} memPoolQueue_cell_t;
+
+/**
+ * Slot queue handle. Producer and consumer positions (and the SPSC cached
+ * copy of the other side) are on different cache lines.
+ */
+typedef struct
+{
+    memPoolMt_handle_t*  ptrPool;                         /**< Originating pool.                   */
+    memPoolQueue_cell_t* ptrCells;                        /**< Cells (capacity).                   */
+    uint32_t             mask;                            /**< Capacity minus one.                 */
+    memPoolQueue_mode_t  mode;                            /**< Queue mode.                         */
+    _Alignas (MEM_POOL_CACHE_LINE) _Atomic uint32_t tail; /**< Next position to enqueue.           */
+    uint32_t             headCache;                       /**< Head last seen by producer (SPSC).  */
+    _Alignas (MEM_POOL_CACHE_LINE) _Atomic uint32_t head; /**< Next position to dequeue.           */
+    uint32_t             tailCache;                       /**< Tail last seen by consumer (SPSC).  */
+} memPoolQueue_handle_t;
+
+/* ************************************************************************** *
+ *                     End of global definitions section                      *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                     Start of global variables section                      *
+ * ************************************************************************** */
+
+/* ************************************************************************** *
+ *                      End of global variables section                       *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                      Start of global function section                      *
+ * ************************************************************************** */
+
+/**
+ * @brief Initialize slot queue routine.
+ *
+ * \p capacity (cells of \p ptrCells) must be a power of two, at most 2^31.
+ * Not thread-safe: queue must not be used by other threads while initialized.
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPoolQueue_init (memPoolQueue_handle_t* ptrHandle,
+                   memPoolMt_handle_t*    ptrPool,
+                   memPoolQueue_cell_t*   ptrCells,
+                   uint32_t               capacity,
+                   memPoolQueue_mode_t    mode);
+
+/**
+ * @brief Enqueue slot routine.
+ *
+ * @return MEM_POOL_OK if no error occurred; MEM_POOL_ERROR_SPACE if queue is
+ *         full; MEM_POOL_ERROR_SLOT_NOT_ALLOCATED if \p ptrSlot is not a slot
+ *         of the pool; anything else otherwise.
+ */
+memPool_error_t
+memPoolQueue_enqueue (memPoolQueue_handle_t* ptrHandle, uint8_t* ptrSlot);
+
+/**
+ * @brief Dequeue slot routine.
+ *
+ * @return MEM_POOL_OK if no error occurred; MEM_POOL_ERROR_SPACE if queue is
+ *         empty; anything else otherwise.
+ */
+memPool_error_t
+memPoolQueue_dequeue (memPoolQueue_handle_t* ptrHandle, uint8_t** ptr2Slot);
+
+/**
+ * @brief Enqueue slots in a batch routine.
+ *
+ * As \ref memPool_allocBulk: if \p ptrDone is NULL, all \p count slots are
+ * enqueued or none is; otherwise as many as fit (stored into \p ptrDone).
+ * Slots are enqueued in array order, contiguously.
+ *
+ * @return MEM_POOL_OK if all slots (best effort: any slot) were enqueued;
+ *         MEM_POOL_ERROR_SPACE if queue is too full;
+ *         MEM_POOL_ERROR_SLOT_NOT_ALLOCATED if a slot is not a slot of the
+ *         pool (nothing enqueued); anything else otherwise.
+ */
+memPool_error_t
+memPoolQueue_enqueueBulk (memPoolQueue_handle_t* ptrHandle,
+                          uint8_t* const*        ptrArray,
+                          uint32_t               count,
+                          uint32_t*              ptrDone);
+
+/**
+ * @brief Dequeue slots in a batch routine.
+ *
+ * As \ref memPoolQueue_enqueueBulk (\p ptrGot NULL: all or nothing). Unused
+ * entries of \p ptrArray are cleared.
+ *
+ * @return MEM_POOL_OK if all slots (best effort: any slot) were dequeued;
+ *         MEM_POOL_ERROR_SPACE if queue holds too few slots; anything else
+ *         otherwise.
+ */
+memPool_error_t
+memPoolQueue_dequeueBulk (memPoolQueue_handle_t* ptrHandle, uint8_t** ptrArray, uint32_t count, uint32_t* ptrGot);
+
+/**
+ * @brief Release dequeued slot to originating pool routine (thread-safe).
+ *
+ * @return See \ref memPoolMt_free.
+ */
+memPool_error_t
+memPoolQueue_release (memPoolQueue_handle_t* ptrHandle, uint8_t* ptrSlot);
+
+/**
+ * @brief Release dequeued slots to originating pool routine (thread-safe).
+ *
+ * @return See \ref memPoolMt_freeBulk.
+ */
+memPool_error_t
+memPoolQueue_releaseBulk (memPoolQueue_handle_t* ptrHandle, uint8_t* const* ptrArray, uint32_t count);
+
+/* ************************************************************************** *
+ *                       End of global function section                       *
+ * ************************************************************************** */
+
+/* ************************************************************************** */
+#endif /* MEM_POOL_QUEUE_H__ */
+/* ************************************************************************** */
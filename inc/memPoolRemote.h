@@ -0,0 +1,153 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2021 Alessandro Morniroli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file   memPoolRemote.h
+ * @author Alessandro Morniroli <alessandro.morniroli@gmail.com>
+ * @date   Sun Oct 18 2026
+ *
+ * @brief  Memory pool with remote free queue interface.
+ *
+ * The pool is owned by one thread, which allocates and frees with no
+ * synchronization at all. Other threads free slots by pushing them on a
+ * lock-free MPSC queue (one CAS); the owner drains the queue in a batch when
+ * its pool runs out of slots.
+ */
+
+/* ************************************************************************** */
+#ifndef MEM_POOL_REMOTE_H__
+#define MEM_POOL_REMOTE_H__
+/* ************************************************************************** */
+
+/* ************************************************************************** *
+ *                         Start of includes section                          *
+ * ************************************************************************** */
+
+/* Standard C. */
+#include <stdatomic.h>
+#include <stdint.h>
+/* Module include. */
+#include "memPool_conf.h"
+#include "memPool.h"
+
+/* ************************************************************************** *
+ *                          End of includes section                           *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                    Start of global definitions section                     *
+ * ************************************************************************** */
+
+/**
+ * Memory pool with remote free queue handle.
+ */
+typedef struct
+{
+    memPool_handle_t   pool;       /**< Owner pool (not thread-safe).            */
+    _Atomic (uint8_t*) remoteHead; /**< Slots freed by other threads (LIFO).     */
+} memPoolRemote_handle_t;
+
+/* ************************************************************************** *
+ *                     End of global definitions section                      *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                     Start of global variables section                      *
+ * ************************************************************************** */
+
+/* ************************************************************************** *
+ *                      End of global variables section                       *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                      Start of global function section                      *
+ * ************************************************************************** */
+
+/**
+ * @brief Initialize mempool with remote free queue routine.
+ *
+ * As \ref memPool_initBitmap (\p ptrBitmap optional). Slots must be at least
+ * a pointer (remote queue is intrusive).
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPoolRemote_init (memPoolRemote_handle_t* ptrHandle,
+                    uint8_t*                ptrStorage,
+                    uint32_t*               ptrBitmap,
+                    uint32_t                slotSize,
+                    uint32_t                slotNumber);
+
+/**
+ * @brief Owner alloc routine (owner thread only).
+ *
+ * If the pool has no slot left, remote free queue is drained first.
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPoolRemote_alloc (memPoolRemote_handle_t* ptrHandle, uint8_t** ptr2Slot);
+
+/**
+ * @brief Owner free routine (owner thread only).
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPoolRemote_free (memPoolRemote_handle_t* ptrHandle, uint8_t* ptrSlot);
+
+/**
+ * @brief Remote free routine (any thread, lock-free).
+ *
+ * Slot is pushed on the remote free queue. Only range and slot boundary are
+ * checked here: pool bitmap belongs to the owner and cannot be read safely. Freeing a slot
+ * twice (remotely, or remotely and by the owner) is undefined behaviour: the
+ * second push rewrites the link of a slot already queued (or free), which
+ * corrupts the queue (or the pool free list) before the owner can check it.
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPoolRemote_freeRemote (memPoolRemote_handle_t* ptrHandle, uint8_t* ptrSlot);
+
+/**
+ * @brief Drain remote free queue routine (owner thread only).
+ *
+ * Whole queue is taken at once (one atomic exchange) and its slots freed into
+ * the pool; their number is stored into \p ptrDrained (if not NULL). Called
+ * by \ref memPoolRemote_alloc on a miss; may also be called in idle time.
+ *
+ * @return MEM_POOL_OK if all slots were freed; anything else otherwise.
+ */
+memPool_error_t
+memPoolRemote_drain (memPoolRemote_handle_t* ptrHandle, uint32_t* ptrDrained);
+
+/* ************************************************************************** *
+ *                       End of global function section                       *
+ * ************************************************************************** */
+
+/* ************************************************************************** */
+#endif /* MEM_POOL_REMOTE_H__ */
+/* ************************************************************************** */
@@ -0,0 +1,156 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2021 Alessandro Morniroli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file   memPoolSet.h
+ * @author Alessandro Morniroli <alessandro.morniroli@gmail.com>
+ * @date   Sun Oct 18 2026
+ *
+ * @brief  Multi size class memory pool interface.
+ *
+ * A pool set splits one storage region into a pool per size class and
+ * serves each request from the smallest class that fits (O(1) lookup table).
+ * Enabled by \ref MEM_POOL_SET_CLASSES.
+ */
+
+/* ************************************************************************** */
+#ifndef MEM_POOL_SET_H__
+#define MEM_POOL_SET_H__
+/* ************************************************************************** */
+
+/* ************************************************************************** *
+ *                         Start of includes section                          *
+ * ************************************************************************** */
+
+/* Standard C. */
+#include <stdint.h>
+/* Module include. */
+#include "memPool_conf.h"
+#include "memPool.h"
+
+/* ************************************************************************** *
+ *                          End of includes section                           *
+ * ************************************************************************** */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#if (defined MEM_POOL_SET_CLASSES && (MEM_POOL_SET_CLASSES > 0))
+
+
+/* ************************************************************************** *
+ *                    Start of global definitions section                     *
+ * ************************************************************************** */
+
+/**
+ * Size granularity (bytes) of the class lookup table.
+ */
+#define MEM_POOL_SET_GRANULE 8U
+
+/**
+ * Size class descriptor.
+ */
+typedef struct
+{
+    uint32_t slotSize;   /**< Single slot size (bytes).  */
+    uint32_t slotNumber; /**< Total number of slots.     */
+} memPoolSet_class_t;
+
+/**
+ * Multi size class memory pool handle.
+ */
+typedef struct
+{
+    memPool_handle_t pools[MEM_POOL_SET_CLASSES];     /**< One pool per class (ascending size). */
+    uint8_t*         ptrEnd[MEM_POOL_SET_CLASSES];    /**< End of each class storage.           */
+    uint32_t         classNumber;                     /**< Number of classes in use.            */
+    uint8_t          lookup[((MEM_POOL_SET_MAX_SLOT_SIZE) / MEM_POOL_SET_GRANULE) + 1U]; /**< Class of size. */
+} memPoolSet_handle_t;
+
+/* ************************************************************************** *
+ *                     End of global definitions section                      *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                     Start of global variables section                      *
+ * ************************************************************************** */
+
+/* ************************************************************************** *
+ *                      End of global variables section                       *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                      Start of global function section                      *
+ * ************************************************************************** */
+
+/**
+ * @brief Initialize pool set routine.
+ *
+ * \p ptrClasses (\p classNumber entries, at most \ref MEM_POOL_SET_CLASSES)
+ * must be sorted by ascending slot size; every slot size must be a multiple
+ * of \ref MEM_POOL_SET_GRANULE, at most \ref MEM_POOL_SET_MAX_SLOT_SIZE. Classes
+ * are laid out one after the other in \p ptrStorage (\p storageSize bytes).
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPoolSet_init (memPoolSet_handle_t*      ptrHandle,
+                 uint8_t*                  ptrStorage,
+                 uint32_t                  storageSize,
+                 const memPoolSet_class_t* ptrClasses,
+                 uint32_t                  classNumber);
+
+/**
+ * @brief Pool set alloc routine.
+ *
+ * Slot is allocated from the smallest class fitting \p size; if that class is
+ * exhausted, from the next larger one.
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPoolSet_alloc (memPoolSet_handle_t* ptrHandle, uint32_t size, uint8_t** ptr2Slot);
+
+/**
+ * @brief Pool set free routine (class is found from the slot address).
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPoolSet_free (memPoolSet_handle_t* ptrHandle, uint8_t* ptrSlot);
+
+/* ************************************************************************** *
+ *                       End of global function section                       *
+ * ************************************************************************** */
+
+#endif /* defined MEM_POOL_SET_CLASSES && (MEM_POOL_SET_CLASSES > 0) */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+/* ************************************************************************** */
+#endif /* MEM_POOL_SET_H__ */
+/* ************************************************************************** */
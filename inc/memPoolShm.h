@@ -0,0 +1,233 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2021 Alessandro Morniroli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file   memPoolShm.h
+ * @author Alessandro Morniroli <alessandro.morniroli@gmail.com>
+ * @date   Sun Oct 18 2026
+ *
+ * @brief  Process-shared (POSIX shared memory) lock-free memory pool interface.
+ *
+ * The whole pool (handle, allocation bitmap and storage) lives inside one
+ * shared region (shm_open/mmap) and holds no pointer: the free list is a
+ * tagged Treiber stack of slot indices, as memPoolMt.h, and slots are passed
+ * between processes as offsets from the region start, so that each process
+ * may map the region at a different address. Atomics are lock-free (address
+ * free), thus they work across processes. A producer allocates a slot,
+ * writes into it and passes its offset to a consumer (zero copies), which
+ * reads it and frees it.
+ */
+
+/* ************************************************************************** */
+#ifndef MEM_POOL_SHM_H__
+#define MEM_POOL_SHM_H__
+/* ************************************************************************** */
+
+/* ************************************************************************** *
+ *                         Start of includes section                          *
+ * ************************************************************************** */
+
+/* Standard C. */
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+/* Module include. */
+#include "memPool_conf.h"
+#include "memPoolMt.h"
+
+/* ************************************************************************** *
+ *                          End of includes section                           *
+ * ************************************************************************** */
+
+#if (defined MEM_POOL_SHM && (MEM_POOL_SHM == 1))
+
+
+/* ************************************************************************** *
+ *                    Start of global definitions section                     *
+ * ************************************************************************** */
+
+/**
+ * Shared region format identifier ("MPSH").
+ */
+#define MEM_POOL_SHM_MAGIC 0x4D505348U
+
+/**
+ * Shared pool handle, at the start of the region (followed by the allocation
+ * bitmap and storage, both cache line aligned). Offsets are from the region
+ * start; head is tagged as \ref memPoolMt_handle_t head.
+ */
+typedef struct
+{
+    _Atomic uint32_t magic;                               /**< MEM_POOL_SHM_MAGIC once initialized.   */
+    uint32_t         slotSize;                            /**< Single slot size (bytes).              */
+    uint32_t         slotNumber;                          /**< Total number of slots.                 */
+    uint32_t         bitmapOffset;                        /**< Allocation bitmap offset (bytes).      */
+    uint64_t         storageOffset;                       /**< First slot offset (bytes).             */
+    uint64_t         regionSize;                          /**< Region size (bytes).                   */
+    _Alignas (MEM_POOL_CACHE_LINE) _Atomic uint64_t head; /**< Tagged free list head.                 */
+    _Atomic uint32_t bumpIndex;                           /**< Index of first slot never handed out.  */
+} memPoolShm_handle_t;
+
+/**
+ * Allocation bitmap size (bytes, rounded up to cache line) of \p slotNumber slots.
+ */
+#define MEM_POOL_SHM_BITMAP_SIZE(slotNumber)                                     \
+    (((((size_t) MEM_POOL_BITMAP_WORDS (slotNumber)) * sizeof (uint32_t)) +      \
+      (MEM_POOL_CACHE_LINE - 1U)) & ~((size_t) (MEM_POOL_CACHE_LINE - 1U)))
+
+/**
+ * Shared region size (bytes) of \p slotNumber slots of \p slotSize bytes.
+ */
+#define MEM_POOL_SHM_REGION_SIZE(slotSize, slotNumber)                           \
+    (sizeof (memPoolShm_handle_t) + MEM_POOL_SHM_BITMAP_SIZE (slotNumber) +     \
+     (((size_t) (slotSize)) * ((size_t) (slotNumber))))
+
+/* ************************************************************************** *
+ *                     End of global definitions section                      *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                     Start of global variables section                      *
+ * ************************************************************************** */
+
+/* ************************************************************************** *
+ *                      End of global variables section                       *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                      Start of global function section                      *
+ * ************************************************************************** */
+
+/**
+ * @brief Initialize shared mempool routine (creator process).
+ *
+ * Pool is laid out in \p ptrRegion (cache line aligned, at least \ref
+ * MEM_POOL_SHM_REGION_SIZE bytes, zero filled as a new shm object), the
+ * handle being the region start. \p slotSize must be a multiple of 4 bytes.
+ * Not process-safe: the region is published (magic stored) last, other
+ * processes attach afterwards.
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPoolShm_init (uint8_t*              ptrRegion,
+                 size_t                regionSize,
+                 uint32_t              slotSize,
+                 uint32_t              slotNumber,
+                 memPoolShm_handle_t** ptr2Handle);
+
+/**
+ * @brief Attach to shared mempool routine (any process, any address).
+ *
+ * @return MEM_POOL_OK if no error occurred; MEM_POOL_ERROR_CORRUPTED if the
+ *         region holds no initialized pool, or one larger than \p
+ *         regionSize; anything else otherwise.
+ */
+memPool_error_t
+memPoolShm_attach (uint8_t* ptrRegion, size_t regionSize, memPoolShm_handle_t** ptr2Handle);
+
+/**
+ * @brief Create shared memory object and initialize shared mempool routine.
+ *
+ * POSIX shared memory object \p name (as shm_open, must not exist) is
+ * created, sized and mapped. Object is not unlinked by \ref
+ * memPoolShm_close: once all processes opened it, shm_unlink may be called.
+ *
+ * @return MEM_POOL_OK if no error occurred; MEM_POOL_ERROR_SPACE if object
+ *         could not be created or mapped; anything else otherwise.
+ */
+memPool_error_t
+memPoolShm_create (const char* name, uint32_t slotSize, uint32_t slotNumber, memPoolShm_handle_t** ptr2Handle);
+
+/**
+ * @brief Open shared memory object and attach to shared mempool routine.
+ *
+ * @return MEM_POOL_OK if no error occurred; MEM_POOL_ERROR_SPACE if object
+ *         could not be opened or mapped; anything else otherwise.
+ */
+memPool_error_t
+memPoolShm_open (const char* name, memPoolShm_handle_t** ptr2Handle);
+
+/**
+ * @brief Unmap shared mempool routine (created or opened).
+ *
+ * Slots allocated by the calling process are not freed.
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPoolShm_close (memPoolShm_handle_t* ptrHandle);
+
+/**
+ * @brief Shared mempool alloc routine (thread and process-safe).
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPoolShm_alloc (memPoolShm_handle_t* ptrHandle, uint8_t** ptr2Slot);
+
+/**
+ * @brief Shared mempool free routine (thread and process-safe).
+ *
+ * A slot may be freed by a process other than the one which allocated it
+ * (through its own mapping, see \ref memPoolShm_slot). A double free is
+ * detected by the allocation bitmap.
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPoolShm_free (memPoolShm_handle_t* ptrHandle, uint8_t* ptrSlot);
+
+/**
+ * @brief Get offset (from region start) of a slot routine.
+ *
+ * @return MEM_POOL_OK if no error occurred; MEM_POOL_ERROR_SLOT_NOT_ALLOCATED
+ *         if \p ptrSlot is not a slot handed out by the pool; anything else
+ *         otherwise.
+ */
+memPool_error_t
+memPoolShm_offset (const memPoolShm_handle_t* ptrHandle, const uint8_t* ptrSlot, uint64_t* ptrOffset);
+
+/**
+ * @brief Get slot at an offset (from region start) routine.
+ *
+ * \p offset may come from another process, mapping the region elsewhere: it
+ * is checked to be a slot handed out by the pool.
+ *
+ * @return MEM_POOL_OK if no error occurred; MEM_POOL_ERROR_SLOT_NOT_ALLOCATED
+ *         if \p offset is not a slot handed out by the pool; anything else
+ *         otherwise.
+ */
+memPool_error_t
+memPoolShm_slot (memPoolShm_handle_t* ptrHandle, uint64_t offset, uint8_t** ptr2Slot);
+
+/* ************************************************************************** *
+ *                       End of global function section                       *
+ * ************************************************************************** */
+
+#endif /* defined MEM_POOL_SHM && (MEM_POOL_SHM == 1) */
+
+/* ************************************************************************** */
+#endif /* MEM_POOL_SHM_H__ */
+/* ************************************************************************** */
@@ -0,0 +1,162 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2021 Alessandro Morniroli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file   memPoolSnapshot.h
+ * @author Alessandro Morniroli <alessandro.morniroli@gmail.com>
+ * @date   Sun Oct 18 2026
+ *
+ * @brief  Memory pool snapshot interface.
+ *
+ * A pool state is saved into a snapshot header (fixed width fields, free list
+ * heads as slot indices) and its free list links are rewritten, in storage,
+ * as slot indices: snapshot, storage and caller supplied arrays (bitmap,
+ * out-of-band free list, generations) hold no pointer, so that they can be
+ * written to a file, or live in a memfd / file backed mapping, and be
+ * restored at another address. Slots (and objects in them) are untouched.
+ */
+
+/* ************************************************************************** */
+#ifndef MEM_POOL_SNAPSHOT_H__
+#define MEM_POOL_SNAPSHOT_H__
+/* ************************************************************************** */
+
+/* ************************************************************************** *
+ *                         Start of includes section                          *
+ * ************************************************************************** */
+
+/* Standard C. */
+#include <stdint.h>
+/* Module include. */
+#include "memPool_conf.h"
+#include "memPool.h"
+
+/* ************************************************************************** *
+ *                          End of includes section                           *
+ * ************************************************************************** */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ************************************************************************** *
+ *                    Start of global definitions section                     *
+ * ************************************************************************** */
+
+/**
+ * Snapshot format identifier ("MPS" and format version).
+ */
+#define MEM_POOL_SNAPSHOT_MAGIC 0x4D505301U
+
+/**
+ * Caller supplied arrays of the pool saved (see \ref memPoolSnapshot_t).
+ */
+#define MEM_POOL_SNAPSHOT_BITMAP 0x01U /**< Allocation bitmap.          */
+#define MEM_POOL_SNAPSHOT_INDEX  0x02U /**< Out-of-band free list.      */
+#define MEM_POOL_SNAPSHOT_GEN    0x04U /**< Slot generations (handles). */
+
+/**
+ * Memory pool snapshot (position independent: slot indices + 1, 0 is none).
+ * FIFO tail is not saved: it is the last slot of the free list.
+ */
+typedef struct
+{
+    uint32_t        magic;       /**< MEM_POOL_SNAPSHOT_MAGIC.                   */
+    uint32_t        flags;       /**< Arrays saved (MEM_POOL_SNAPSHOT_xxx).      */
+    uint32_t        slotSize;    /**< Single slot size (bytes).                  */
+    uint32_t        slotNumber;  /**< Total number of slots.                     */
+    uint32_t        bumpIndex;   /**< Index of first slot never handed out.      */
+    uint32_t        bumpHigh;    /**< Highest bumpIndex before last reset.       */
+    uint32_t        indexTop;    /**< Slot indices on out-of-band free list.     */
+    uint32_t        head;        /**< Free list head.                            */
+    uint32_t        dirty;       /**< Slots to be cleared head (deferred).       */
+    uint32_t        zeroPolicy;  /**< Slot clearing policy.                      */
+    uint32_t        zeroBytes;   /**< Bytes cleared on alloc (partial policy).   */
+    uint32_t        order;       /**< Free list order.                           */
+    uint32_t        debugFlags;  /**< Debug checks.                              */
+    uint32_t        corruptions; /**< Corrupted slots detected.                  */
+    memPool_stats_t stats;       /**< Statistics (zero if disabled).             */
+} memPoolSnapshot_t;
+
+/* ************************************************************************** *
+ *                     End of global definitions section                      *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                     Start of global variables section                      *
+ * ************************************************************************** */
+
+/* ************************************************************************** *
+ *                      End of global variables section                       *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                      Start of global function section                      *
+ * ************************************************************************** */
+
+/**
+ * @brief Save mempool snapshot routine.
+ *
+ * Pool state is stored into \p ptrSnapshot and free list links (in storage)
+ * are rewritten as slot indices, in O(number of free slots); pools with an
+ * out-of-band free list have none. Pool must not be used afterwards, until
+ * restored (at the same address or another one).
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPoolSnapshot_save (memPool_handle_t* ptrHandle, memPoolSnapshot_t* ptrSnapshot);
+
+/**
+ * @brief Restore mempool snapshot routine.
+ *
+ * Pool is rebuilt on \p ptrStorage (content of the storage saved, possibly
+ * mapped at another address) and on arrays holding content of the ones saved
+ * (NULL if not saved): slots are not initialized again, links are turned back
+ * into pointers in O(number of free slots). Snapshot and links are checked
+ * (MEM_POOL_ERROR_CORRUPTED if not consistent: storage must be restored from
+ * the saved content again).
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPoolSnapshot_restore (memPool_handle_t*        ptrHandle,
+                         const memPoolSnapshot_t* ptrSnapshot,
+                         uint8_t*                 ptrStorage,
+                         uint32_t*                ptrBitmap,
+                         memPool_index_t*         ptrIndex,
+                         uint32_t*                ptrGen);
+
+/* ************************************************************************** *
+ *                       End of global function section                       *
+ * ************************************************************************** */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+/* ************************************************************************** */
+#endif /* MEM_POOL_SNAPSHOT_H__ */
+/* ************************************************************************** */
@@ -0,0 +1,170 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2021 Alessandro Morniroli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file   memPoolTrace.h
+ * @author Alessandro Morniroli <alessandro.morniroli@gmail.com>
+ * @date   Sun Oct 18 2026
+ *
+ * @brief  Memory pool allocation tracing interface.
+ *
+ * If enabled (MEM_POOL_TRACE), \ref memPool_alloc and \ref memPool_free record
+ * an event (pool, slot index, caller return address, timestamp) into a ring
+ * of the calling thread (wrappers, e.g. memPoolSet, record their caller):
+ * rings are statically allocated, claimed by threads
+ * on first event, written with no lock nor read-modify-write (oldest events
+ * overwritten). \ref memPoolTrace_drain hands events to a sink, e.g. writing
+ * a binary log (\ref memPoolTrace_fileHeader_t then events) that the
+ * offline decoder (tools/memPoolTraceDecode.c) turns into per-callsite live
+ * slot counts and lifetime histograms.
+ */
+
+/* ************************************************************************** */
+#ifndef MEM_POOL_TRACE_H__
+#define MEM_POOL_TRACE_H__
+/* ************************************************************************** */
+
+/* ************************************************************************** *
+ *                         Start of includes section                          *
+ * ************************************************************************** */
+
+/* Standard C. */
+#include <stdint.h>
+/* Module include. */
+#include "memPool_conf.h"
+#include "memPool.h"
+
+/* ************************************************************************** *
+ *                          End of includes section                           *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                    Start of global definitions section                     *
+ * ************************************************************************** */
+
+/**
+ * Trace log format identifier ("MPT" and format version).
+ */
+#define MEM_POOL_TRACE_MAGIC 0x4D505401U
+
+/**
+ * Event types.
+ */
+#define MEM_POOL_TRACE_ALLOC 0x01U /**< Slot allocated.  */
+#define MEM_POOL_TRACE_FREE  0x02U /**< Slot freed.      */
+
+/**
+ * Event timestamp clocks.
+ */
+#define MEM_POOL_TRACE_CLOCK_TSC 0x00U /**< CPU time stamp counter (cycles).  */
+#define MEM_POOL_TRACE_CLOCK_NS  0x01U /**< Wall clock (nanoseconds).         */
+
+/**
+ * Trace event (fixed width fields, 32 bytes).
+ */
+typedef struct
+{
+    uint64_t timestamp; /**< Timestamp (see \ref memPoolTrace_fileHeader_t clock). */
+    uint64_t pool;      /**< Pool handle address.                                 */
+    uint64_t caller;    /**< Caller return address.                               */
+    uint32_t slot;      /**< Slot index.                                          */
+    uint16_t type;      /**< Event type (MEM_POOL_TRACE_xxx).                     */
+    uint16_t thread;    /**< Ring (thread) number.                                */
+} memPoolTrace_event_t;
+
+/**
+ * Trace log header (followed by events).
+ */
+typedef struct
+{
+    uint32_t magic;     /**< MEM_POOL_TRACE_MAGIC.                  */
+    uint32_t eventSize; /**< Event size (bytes).                    */
+    uint32_t clock;     /**< Timestamp clock (MEM_POOL_TRACE_CLOCK_xxx). */
+    uint32_t reserved;  /**< Reserved (zero).                       */
+} memPoolTrace_fileHeader_t;
+
+#if (defined MEM_POOL_TRACE && (MEM_POOL_TRACE == 1))
+/**
+ * Trace sink: \p count events of one ring, oldest first.
+ */
+typedef void (*memPoolTrace_sink_t)(void* ptrContext, const memPoolTrace_event_t* ptrEvents, uint32_t count);
+#endif /* defined MEM_POOL_TRACE && (MEM_POOL_TRACE == 1) */
+
+/* ************************************************************************** *
+ *                     End of global definitions section                      *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                     Start of global variables section                      *
+ * ************************************************************************** */
+
+/* ************************************************************************** *
+ *                      End of global variables section                       *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                      Start of global function section                      *
+ * ************************************************************************** */
+
+#if (defined MEM_POOL_TRACE && (MEM_POOL_TRACE == 1))
+/**
+ * @brief Record trace event routine (called by traced routines).
+ *
+ * Lock-free: only the calling thread writes its ring. If no ring is left
+ * for the calling thread, event is dropped.
+ */
+void
+memPoolTrace_record (uint32_t type, const void* ptrPool, uint32_t slot, const void* ptrCaller);
+
+/**
+ * @brief Drain trace rings routine.
+ *
+ * Events recorded since last drain are handed to \p sink, ring by ring, in
+ * chunks (thread-safe with respect to recording; one drainer at a time).
+ * Events overwritten before being drained (once a ring wrapped, the oldest
+ * one too: it may be being overwritten), or recorded by threads with no
+ * ring, are counted into \p ptrDropped (optional).
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPoolTrace_drain (memPoolTrace_sink_t sink, void* ptrContext, uint64_t* ptrDropped);
+
+/**
+ * @brief Fill trace log header routine.
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+memPool_error_t
+memPoolTrace_fileHeader (memPoolTrace_fileHeader_t* ptrHeader);
+#endif /* defined MEM_POOL_TRACE && (MEM_POOL_TRACE == 1) */
+
+/* ************************************************************************** *
+ *                       End of global function section                       *
+ * ************************************************************************** */
+
+/* ************************************************************************** */
+#endif /* MEM_POOL_TRACE_H__ */
+/* ************************************************************************** */
@@ -33,12 +33,27 @@
  * ************************************************************************** */
 
 /* Standard C. */
-#include <stdbool.h>
 #include <stddef.h>
 #include <string.h>
+#if (defined __SSE2__)
+    /* SSE2 (non-temporal stores). */
+    #include <emmintrin.h>
+#endif /* __SSE2__ */
+#if (defined __SANITIZE_ADDRESS__)
+    #define MEM_POOL_ASAN 1
+#elif (defined __has_feature)
+    #if (__has_feature (address_sanitizer))
+        #define MEM_POOL_ASAN 1
+    #endif
+#endif /* __SANITIZE_ADDRESS__ */
+#if (defined MEM_POOL_ASAN)
+    /* AddressSanitizer (manual poisoning). */
+    #include <sanitizer/asan_interface.h>
+#endif /* MEM_POOL_ASAN */
 /* Module include. */
-#include "memPool_conf.h"
+#include "memPool_priv.h"
 #include "memPool.h"
+#include "memPoolTrace.h"
 
 /* ************************************************************************** *
  *                          End of includes section                           *
@@ -50,18 +65,83 @@
  * ************************************************************************** */
 
 /**
- * Check parameters macro.
+ * Where a slot being allocated comes from (see memPool_allocated).
  */
-#if (!defined MEM_POOL_CHECK_PARAMS || (MEM_POOL_CHECK_PARAMS == 0))
-    #define memPool_checkParam(...)
+#define MEM_POOL_FROM_LIST  0U /**< Free list.                                  */
+#define MEM_POOL_FROM_DIRTY 1U /**< Slots freed, not cleared yet (deferred).    */
+#define MEM_POOL_FROM_BUMP  2U /**< Never handed out before.                    */
+
+/**
+ * Non-temporal clearing supported and enabled?
+ */
+#if (defined __SSE2__ && defined MEM_POOL_ZERO_STREAM_MIN && (MEM_POOL_ZERO_STREAM_MIN > 0))
+    #define MEM_POOL_ZERO_STREAM 1
 #else
-    #define memPool_checkParam(pX)           \
-        if ((pX) == false)                   \
-        {                                    \
-            ret = MEM_POOL_ERROR_PARAMETERS; \
-        }                                    \
-        else
-#endif /* MEM_POOL_CHECK_PARAMS && (MEM_POOL_CHECK_PARAMS == 1) */
+    #define MEM_POOL_ZERO_STREAM 0
+#endif
+
+/**
+ * Slot handle layout: index bits (default: 20 for 32-bit handles, 32 for
+ * 64-bit ones) then generation bits.
+ */
+#if (defined MEM_POOL_HANDLE_INDEX_BITS)
+    #define MEM_POOL_HANDLE_INDEX (MEM_POOL_HANDLE_INDEX_BITS)
+#elif (defined MEM_POOL_HANDLE_BITS && (MEM_POOL_HANDLE_BITS == 64))
+    #define MEM_POOL_HANDLE_INDEX 32U
+#else
+    #define MEM_POOL_HANDLE_INDEX 20U
+#endif /* MEM_POOL_HANDLE_INDEX_BITS */
+
+#define MEM_POOL_HANDLE_INDEX_MASK ((((memPool_slotHandle_t) 1U) << MEM_POOL_HANDLE_INDEX) - 1U)
+#define MEM_POOL_HANDLE_GEN_MASK \
+    ((uint32_t) (((memPool_slotHandle_t) ~((memPool_slotHandle_t) 0U)) >> MEM_POOL_HANDLE_INDEX))
+
+/**
+ * Largest slot index of an out-of-band free list.
+ */
+#define MEM_POOL_INDEX_MAX ((uint32_t) ((memPool_index_t) ~((memPool_index_t) 0U)))
+
+/**
+ * Debug mode: freed slots range checked in O(1), even with no bitmap.
+ */
+#if (defined MEM_POOL_DEBUG && (MEM_POOL_DEBUG == 1))
+    #define MEM_POOL_DEBUG_CHECKS true
+#else
+    #define MEM_POOL_DEBUG_CHECKS false
+#endif
+
+/**
+ * Debug mode patterns: freed slots (poison) and slot end (canary).
+ */
+#define MEM_POOL_POISON_BYTE 0xDDU
+#define MEM_POOL_CANARY_BYTE 0xCBU
+
+/**
+ * Sanitizer manual poisoning (debug mode only).
+ */
+#if (defined MEM_POOL_ASAN && defined MEM_POOL_DEBUG && (MEM_POOL_DEBUG == 1))
+    #define memPool_asanPoison(ptr, size)   ASAN_POISON_MEMORY_REGION ((ptr), (size))
+    #define memPool_asanUnpoison(ptr, size) ASAN_UNPOISON_MEMORY_REGION ((ptr), (size))
+#else
+    #define memPool_asanPoison(ptr, size)   ((void) (ptr), (void) (size))
+    #define memPool_asanUnpoison(ptr, size) ((void) (ptr), (void) (size))
+#endif
+
+/**
+ * Trace hook (tracing only): records a slot allocated / freed, with the
+ * caller of the traced routine (see \ref memPool_caller).
+ */
+#if (defined MEM_POOL_TRACE && (MEM_POOL_TRACE == 1))
+    #define memPool_trace(ret, type, pH, pS, pC)                                                         \
+        if ((ret) == MEM_POOL_OK)                                                                        \
+        {                                                                                                \
+            memPoolTrace_record ((type), (pH),                                                           \
+                                 (uint32_t) ((uintptr_t) ((pS) - (pH)->ptrStorage) / (pH)->slotSize),    \
+                                 (pC));                                                                  \
+        }
+#else
+    #define memPool_trace(ret, type, pH, pS, pC) ((void) (pC))
+#endif /* MEM_POOL_TRACE && (MEM_POOL_TRACE == 1) */
 
 /* ************************************************************************** *
  *                     End of private definitions section                     *
@@ -90,6 +170,38 @@
  *                Start of private function prototypes section                *
  * ************************************************************************** */
 
+static void
+memPool_push (memPool_handle_t* ptrHandle, uint8_t* ptrSlot);
+
+static void
+memPool_link (memPool_handle_t* ptrHandle, uint8_t* ptrSlot);
+
+static uint8_t*
+memPool_pop (uint8_t** ptr2Head);
+
+static memPool_error_t
+memPool_checkAllocated (const memPool_handle_t* ptrHandle, const uint8_t* ptrSlot);
+
+static memPool_error_t
+memPool_take (memPool_handle_t* ptrHandle, uint8_t** ptr2Slot, bool* ptrZeroed);
+
+static bool
+memPool_allocated (memPool_handle_t* ptrHandle, uint8_t* ptrSlot, uint32_t origin);
+
+static memPool_error_t
+memPool_release (memPool_handle_t* ptrHandle, uint8_t* ptrSlot);
+
+static bool
+memPool_debugAlloc (memPool_handle_t* ptrHandle, uint8_t* ptrSlot, uint32_t origin, bool commit);
+
+static bool
+memPool_debugFree (memPool_handle_t* ptrHandle, uint8_t* ptrSlot);
+
+#if (defined memPool_zeroize && (memPool_zeroize == 1))
+static void
+memPool_clear (uint8_t* ptr, uint32_t size);
+#endif /* memPool_zeroize && (memPool_zeroize == 1) */
+
 /* ************************************************************************** *
  *                 End of private function prototypes section                 *
  * ************************************************************************** */
@@ -99,188 +211,1650 @@
  *                     Start of private function section                      *
  * ************************************************************************** */
 
-/* ************************************************************************** *
- *                      End of private function section                       *
- * ************************************************************************** */
+/**
+ * @brief Push a slot on the free list (no checks).
+ *
+ * Slot is cleared first (clear on free policy), or pushed on the list of slots
+ * to be cleared (deferred policy). With an out-of-band free list, only its
+ * index is pushed (slot untouched).
+ */
+static void
+memPool_push (memPool_handle_t* ptrHandle, uint8_t* ptrSlot)
+{
+#if (defined memPool_zeroize && (memPool_zeroize == 1))
+    if (ptrHandle->zeroPolicy == MEM_POOL_ZERO_ON_FREE)
+    {
+        uint32_t link;
 
+        /* Clear while hot in cache (link word, if any, is cleared on pop). */
+        link = (ptrHandle->ptrIndex != NULL) ? 0U : (uint32_t) sizeof (uint8_t*);
+        (void) memset (&ptrSlot[link], 0x00, (ptrHandle->slotSize - link));
 
-/* ************************************************************************** *
- *                      Start of global function section                      *
- * ************************************************************************** */
+        /* Link slot freed. */
+        memPool_link (ptrHandle, ptrSlot);
+    }
+    else if (ptrHandle->zeroPolicy == MEM_POOL_ZERO_DEFERRED)
+    {
+        /* Cleared later, by memPool_zeroDirty (no out-of-band list). */
+        *((uint8_t**) ptrSlot) = ptrHandle->ptrDirty;
+        ptrHandle->ptrDirty    = ptrSlot;
+    }
+    else
+    {
+        /* Cleared on alloc. */
+        memPool_link (ptrHandle, ptrSlot);
+    }
+#else
+    /* Link slot freed. */
+    memPool_link (ptrHandle, ptrSlot);
+#endif /* memPool_zeroize && (memPool_zeroize == 1) */
 
-memPool_error_t
-memPool_init (memPool_handle_t* ptrHandle,
-              uint8_t*          ptrStorage,
-              uint32_t          slotSize,
-              uint32_t          slotNumber)
+#if (defined MEM_POOL_DEBUG && (MEM_POOL_DEBUG == 1))
+    if ((ptrHandle->debugFlags & MEM_POOL_DEBUG_POISON) != 0U)
+    {
+        uint32_t link;
+
+        /* Free slot off limits (sanitizer), but its link word. */
+        link = (ptrHandle->ptrIndex != NULL) ? 0U : (uint32_t) sizeof (uint8_t*);
+        memPool_asanPoison (&ptrSlot[link], (ptrHandle->slotSize - link));
+    }
+#endif /* MEM_POOL_DEBUG && (MEM_POOL_DEBUG == 1) */
+}
+
+/**
+ * @brief Link a slot in the free list, as the pool order requires.
+ *
+ * LIFO (and out-of-band list) push is O(1), FIFO append at tail is O(1) too;
+ * address order walks the list up to the insertion point.
+ */
+static void
+memPool_link (memPool_handle_t* ptrHandle, uint8_t* ptrSlot)
 {
-    memPool_error_t ret;
+    memPool_order_t order;
 
-    /* Assert block (if defined). */
-    memPool_assert ((ptrHandle  != NULL) &&
-                    (ptrStorage != NULL) &&
-                    (slotSize   != 0U)   &&
-                    (slotNumber != 0U));
+#if (defined MEM_POOL_FREE_ORDER && (MEM_POOL_FREE_ORDER == 1))
+    order = ptrHandle->order;
+#else
+    order = MEM_POOL_ORDER_LIFO;
+#endif /* MEM_POOL_FREE_ORDER && (MEM_POOL_FREE_ORDER == 1) */
 
-    /* Check parameters (if defined). */
-    memPool_checkParam ((ptrHandle  != NULL) &&
-                        (ptrStorage != NULL) &&
-                        (slotSize   != 0U)   &&
-                        (slotNumber != 0U))
+    /* Out-of-band free list? */
+    if (ptrHandle->ptrIndex != NULL)
     {
-        uint32_t i;
+        memPool_index_t idx;
+        uint32_t        k;
 
-        /* Clear pool & storage (just in case). */
-        (void) memset (ptrHandle,  0x00, sizeof (*ptrHandle));
-        (void) memset (ptrStorage, 0x00, (slotSize * slotNumber));
+        /* Slot index (less than slotNumber). */
+        idx = (memPool_index_t) ((uintptr_t) (ptrSlot - ptrHandle->ptrStorage) / ptrHandle->slotSize);
+        k   = ptrHandle->indexTop;
 
-        /* Copy pool info. */
-        ptrHandle->slotSize   = slotSize;
-        ptrHandle->slotNumber = slotNumber;
+        /* Address order: top of the stack is the lowest index, shift lower ones up. */
+        while ((order == MEM_POOL_ORDER_ADDRESS) && (k != 0U) && (ptrHandle->ptrIndex[k - 1U] < idx))
+        {
+            ptrHandle->ptrIndex[k] = ptrHandle->ptrIndex[k - 1U];
+            k--;
+        }
 
-        /* Initialize loop variables (start from end, just to debug easily). */
-        ret = MEM_POOL_OK;
-        i   = slotNumber;
+        /* Slot index is the new top of the stack (at most slotNumber). */
+        ptrHandle->ptrIndex[k] = idx;
+        ptrHandle->indexTop++;
+    }
+#if (defined MEM_POOL_FREE_ORDER && (MEM_POOL_FREE_ORDER == 1))
+    /* FIFO, not empty? */
+    else if ((order == MEM_POOL_ORDER_FIFO) && (ptrHandle->ptrHead != NULL))
+    {
+        /* Slot freed is the new tail. */
+        *((uint8_t**) ptrSlot)            = NULL;
+        *((uint8_t**) ptrHandle->ptrTail) = ptrSlot;
+        ptrHandle->ptrTail                = ptrSlot;
+    }
+#endif /* MEM_POOL_FREE_ORDER && (MEM_POOL_FREE_ORDER == 1) */
+    else
+    {
+        uint8_t** ptr2Link;
 
-        /* Loop to set all slots as freed. */
-        do
+        /* Head of the list, or first slot above (address order). */
+        ptr2Link = &ptrHandle->ptrHead;
+
+        while ((order == MEM_POOL_ORDER_ADDRESS) && (*ptr2Link != NULL) && (*ptr2Link < ptrSlot))
         {
-            uint8_t* ptrSlot;
+            ptr2Link = (uint8_t**) *ptr2Link;
+        }
 
-            /* Decrement index. */
-            i--;
+        /* Set item freed to point to the next one. */
+        *((uint8_t**) ptrSlot) = *ptr2Link;
 
-            /* Set pointer to slot. */
-            ptrSlot = &ptrStorage[(i * slotSize)];
+        /* Slot freed takes its place. */
+        *ptr2Link = ptrSlot;
 
-            /* Free block. */
-            ret = memPool_free (ptrHandle, ptrSlot);
-        } while ((ret == MEM_POOL_OK) && (i > 0U));
+    #if (defined MEM_POOL_FREE_ORDER && (MEM_POOL_FREE_ORDER == 1))
+        /* Only slot (FIFO tail). */
+        if (*((uint8_t**) ptrSlot) == NULL)
+        {
+            ptrHandle->ptrTail = ptrSlot;
+        }
+    #endif /* MEM_POOL_FREE_ORDER && (MEM_POOL_FREE_ORDER == 1) */
     }
+}
 
-    /* Assert block (if defined). */
-    memPool_assert (ret == MEM_POOL_OK);
+/**
+ * @brief Pop the slot on top of a (not empty) free list (link cleared).
+ */
+static uint8_t*
+memPool_pop (uint8_t** ptr2Head)
+{
+    uint8_t* ptrSlot;
 
-    /* Return the function result code. */
-    return ret;
+    /* Current head is the slot popped. */
+    ptrSlot = *ptr2Head;
+
+    /* Update head to next slot. */
+    *ptr2Head = *((uint8_t**) ptrSlot);
+
+    /* Clear next. */
+    *((uint8_t**) ptrSlot) = NULL;
+
+    /* Return the slot. */
+    return ptrSlot;
 }
 
-memPool_error_t
-memPool_alloc (memPool_handle_t* ptrHandle, uint8_t** ptr2Slot)
+/**
+ * @brief Check that a slot is currently allocated.
+ *
+ * Slots never handed out by the bump pointer are always rejected. If the pool
+ * has an allocation bitmap, the check is O(1) (and the slot is also checked
+ * to belong to the pool, as in debug mode); otherwise the free list is walked,
+ * unless \ref MEM_POOL_UNCHECKED_FREE is enabled.
+ *
+ * @return MEM_POOL_OK if slot is allocated; MEM_POOL_ERROR_SLOT_NOT_ALLOCATED
+ *         otherwise.
+ */
+static memPool_error_t
+memPool_checkAllocated (const memPool_handle_t* ptrHandle, const uint8_t* ptrSlot)
 {
     memPool_error_t ret;
+    uintptr_t       offset;
 
-    /* Assert block (if defined). */
-    memPool_assert ((ptrHandle != NULL) && (ptr2Slot != NULL));
+    /* Clear error code. */
+    ret = MEM_POOL_OK;
 
-    /* Check parameters (if defined). */
-    memPool_checkParam ((ptrHandle != NULL) && (ptr2Slot != NULL))
+    /* Slot offset inside storage (wraps if below storage). */
+    offset = ((uintptr_t) ptrSlot) - ((uintptr_t) ptrHandle->ptrStorage);
+
+    /* Inside pool, but never handed out (bump area)? Or all slots free? */
+    if (((offset <  (((uintptr_t) ptrHandle->slotSize) * ptrHandle->slotNumber)) &&
+         (offset >= (((uintptr_t) ptrHandle->slotSize) * ptrHandle->bumpIndex))) ||
+        (ptrHandle->indexTop >= ptrHandle->bumpIndex))
+    {
+        /* Error! Slot was not allocated! */
+        ret = MEM_POOL_ERROR_SLOT_NOT_ALLOCATED;
+    }
+    /* Outside pool or not on a slot boundary (bitmap supplied, or debug mode)? */
+    else if (((ptrHandle->ptrBitmap != NULL) || MEM_POOL_DEBUG_CHECKS)                    &&
+             ((offset >= (((uintptr_t) ptrHandle->slotSize) * ptrHandle->slotNumber)) ||
+              ((offset % ptrHandle->slotSize) != 0U)))
+    {
+        /* Error! Slot was not allocated! */
+        ret = MEM_POOL_ERROR_SLOT_NOT_ALLOCATED;
+    }
+    /* Allocation bitmap supplied? */
+    else if (ptrHandle->ptrBitmap != NULL)
     {
-        /* Empty? */
-        if (ptrHandle->ptrHead == NULL)
+        uint32_t idx;
+
+        /* Slot index. */
+        idx = (uint32_t) (offset / ptrHandle->slotSize);
+
+        /* Not allocated? */
+        if ((ptrHandle->ptrBitmap[memPool_bitmapWord (idx)] & memPool_bitmapMask (idx)) == 0U)
         {
-            /* Clear pointer. */
-            *ptr2Slot = NULL;
+            /* Error! Slot was not allocated! */
+            ret = MEM_POOL_ERROR_SLOT_NOT_ALLOCATED;
+        }
+    }
+    else
+    {
+    #if (!defined MEM_POOL_UNCHECKED_FREE || (MEM_POOL_UNCHECKED_FREE == 0))
+        const uint8_t* lists[2];
+        const uint8_t* ptr;
+        uint32_t       l;
 
-            /* Error! No free slots! */
-            ret = MEM_POOL_ERROR_SPACE;
+        /* Assert that item is not in out-of-band free list. */
+        for (l = 0U; l < ptrHandle->indexTop; l++)
+        {
+            if (&ptrHandle->ptrStorage[(((uint32_t) ptrHandle->ptrIndex[l]) * ptrHandle->slotSize)] == ptrSlot)
+            {
+                /* Error! Slot was not allocated! */
+                ret = MEM_POOL_ERROR_SLOT_NOT_ALLOCATED;
+            }
         }
-        else
+
+        /* Free list and slots to be cleared (deferred policy). */
+        lists[0] = ptrHandle->ptrHead;
+    #if (defined memPool_zeroize && (memPool_zeroize == 1))
+        lists[1] = ptrHandle->ptrDirty;
+    #else
+        lists[1] = NULL;
+    #endif /* memPool_zeroize && (memPool_zeroize == 1) */
+
+        for (l = 0U; l < 2U; l++)
         {
-            uint8_t* ptrTemp;
+            /* Assert that item is not in list. */
+            ptr = lists[l];
 
-            /* Temp store next slot of the current head. */
-            ptrTemp = *(((uint8_t**) ptrHandle->ptrHead));
+            while ((ret == MEM_POOL_OK) && (ptr != NULL))
+            {
+                /* Same address? */
+                if (ptr != ptrSlot)
+                {
+                    /* Update pointer. */
+                    ptr = *((uint8_t* const*) ptr);
+                }
+                else
+                {
+                    /* Error! Slot was not allocated! */
+                    ret = MEM_POOL_ERROR_SLOT_NOT_ALLOCATED;
+                }
+            }
+        }
+    #endif /* !MEM_POOL_UNCHECKED_FREE || (MEM_POOL_UNCHECKED_FREE == 0) */
+    }
 
-            /* Store pointer to dest (current head is the slot allocated). */
-            *ptr2Slot = ptrHandle->ptrHead;
+    /* Return the function result code. */
+    return ret;
+}
 
-        #if (defined memPool_zeroize && (memPool_zeroize == 1))
-            /* Zeroise the slot (as calloc). */
-            (void) memset (*ptr2Slot, 0x00, ptrHandle->slotSize);
-        #endif /* memPool_zeroize && (memPool_zeroize == 1) */
+/**
+ * @brief Finalize allocation of a slot (zeroize & mark as allocated).
+ *
+ * Slot is cleared as the pool policy requires, given where it comes from
+ * (\p origin, list slots have their link cleared already).
+ *
+ * @return true if whole slot is zero; false otherwise.
+ */
+static bool
+memPool_allocated (memPool_handle_t* ptrHandle, uint8_t* ptrSlot, uint32_t origin)
+{
+    bool zeroed;
 
-            /* Clear next. */
-            *((uint8_t**) ptrHandle->ptrHead) = NULL;
+    /* Update statistics (if defined). */
+    memPool_statsAdd (&ptrHandle->stats, allocs, 1U);
+    memPool_statsAdd (&ptrHandle->stats, inUse,  1U);
 
-            /* Update head. */
-            ptrHandle->ptrHead = ptrTemp;
+    /* Nothing known. */
+    zeroed = false;
 
-            /* Succeed! */
-            ret = MEM_POOL_OK;
+#if (defined MEM_POOL_DEBUG && (MEM_POOL_DEBUG == 1))
+    if (ptrHandle->debugFlags != 0U)
+    {
+        /* Slot usable (sanitizer). */
+        memPool_asanUnpoison (ptrSlot, ptrHandle->slotSize);
+    }
+#endif /* MEM_POOL_DEBUG && (MEM_POOL_DEBUG == 1) */
+
+    /* Slot from bump pointer and slot handles enabled? */
+    if ((origin == MEM_POOL_FROM_BUMP) && (ptrHandle->ptrGen != NULL))
+    {
+        uint32_t idx;
+
+        idx = (uint32_t) ((uintptr_t) (ptrSlot - ptrHandle->ptrStorage) / ptrHandle->slotSize);
+
+        /* Handed out for the first time? */
+        if (idx >= ptrHandle->bumpHigh)
+        {
+            /* First generation (lazily initialized). */
+            ptrHandle->ptrGen[idx] = 1U;
+        }
+        else
+        {
+            /* Released by reset: new generation (0 is skipped). */
+            ptrHandle->ptrGen[idx]++;
+
+            if ((ptrHandle->ptrGen[idx] & MEM_POOL_HANDLE_GEN_MASK) == 0U)
+            {
+                ptrHandle->ptrGen[idx]++;
+            }
         }
     }
 
-    memPool_assert (ret == MEM_POOL_OK);
+#if (defined memPool_zeroize && (memPool_zeroize == 1))
+    if (ptrHandle->zeroPolicy == MEM_POOL_ZERO_PARTIAL)
+    {
+        /* Zeroise the first bytes only. */
+        (void) memset (ptrSlot, 0x00,
+                       ((ptrHandle->zeroBytes < ptrHandle->slotSize) ? ptrHandle->zeroBytes : ptrHandle->slotSize));
+        zeroed = (ptrHandle->zeroBytes >= ptrHandle->slotSize);
+    }
+    else if ((ptrHandle->zeroPolicy == MEM_POOL_ZERO_ON_ALLOC) || (origin == MEM_POOL_FROM_BUMP))
+    {
+        /* Zeroise the slot (as calloc). */
+        (void) memset (ptrSlot, 0x00, ptrHandle->slotSize);
+        zeroed = true;
+    }
+    else
+    {
+        /* Cleared on free (or by memPool_zeroDirty), unless still dirty. */
+        zeroed = (origin != MEM_POOL_FROM_DIRTY);
+    }
+#else
+    (void) origin;
+#endif /* memPool_zeroize && (memPool_zeroize == 1) */
 
-    /* Return the function result code. */
-    return ret;
+    /* Bitmap supplied? */
+    if (ptrHandle->ptrBitmap != NULL)
+    {
+        uint32_t idx;
+
+        /* Mark slot as allocated. */
+        idx = (uint32_t) ((uintptr_t) (ptrSlot - ptrHandle->ptrStorage) / ptrHandle->slotSize);
+        ptrHandle->ptrBitmap[memPool_bitmapWord (idx)] |= memPool_bitmapMask (idx);
+    }
+
+#if (defined MEM_POOL_DEBUG && (MEM_POOL_DEBUG == 1))
+    if ((ptrHandle->debugFlags & MEM_POOL_DEBUG_CANARY) != 0U)
+    {
+        /* Canary at slot end, off limits (sanitizer). */
+        (void) memset (&ptrSlot[(ptrHandle->slotSize - MEM_POOL_CANARY_SIZE)], (int) MEM_POOL_CANARY_BYTE,
+                       MEM_POOL_CANARY_SIZE);
+        memPool_asanPoison (&ptrSlot[(ptrHandle->slotSize - MEM_POOL_CANARY_SIZE)], MEM_POOL_CANARY_SIZE);
+    }
+#endif /* MEM_POOL_DEBUG && (MEM_POOL_DEBUG == 1) */
+
+    /* Return whether slot is zero. */
+    return zeroed;
 }
 
-memPool_error_t
-memPool_free (memPool_handle_t* ptrHandle, uint8_t* ptrSlot)
+/**
+ * @brief Release an allocated slot (check & mark as freed, not linked yet).
+ *
+ * @return MEM_POOL_OK if slot was allocated; anything else otherwise.
+ */
+static memPool_error_t
+memPool_release (memPool_handle_t* ptrHandle, uint8_t* ptrSlot)
 {
     memPool_error_t ret;
 
-    /* Assert block (if defined). */
-    memPool_assert ((ptrHandle != NULL) && (ptrSlot != NULL));
+    /* Check that slot was allocated. */
+    ret = memPool_checkAllocated (ptrHandle, ptrSlot);
 
-    /* Check parameters (if defined). */
-    memPool_checkParam ((ptrHandle != NULL) && (ptrSlot != NULL))
+    /* Overflowed (debug mode)? Slot quarantined: stays allocated. */
+    if ((ret == MEM_POOL_OK) && !memPool_debugFree (ptrHandle, ptrSlot))
+    {
+        /* Error! Slot was corrupted! */
+        ret = MEM_POOL_ERROR_CORRUPTED;
+    }
+
+    /* Update statistics (if defined). */
+    if (ret == MEM_POOL_OK)
+    {
+        memPool_statsAdd (&ptrHandle->stats, frees, 1U);
+        memPool_statsSub (&ptrHandle->stats, inUse, 1U);
+    }
+    else
     {
-        void* ptr;
+        memPool_statsAdd (&ptrHandle->stats, freeFailures, 1U);
+    }
 
-        /* Clear error code. */
-        ret = MEM_POOL_OK;
+    /* Succeed and bitmap supplied? */
+    if ((ret == MEM_POOL_OK) && (ptrHandle->ptrBitmap != NULL))
+    {
+        uint32_t idx;
 
-        /* Assert that item is not in list. */
-        ptr = ptrHandle->ptrHead;
+        /* Mark slot as freed. */
+        idx = (uint32_t) ((uintptr_t) (ptrSlot - ptrHandle->ptrStorage) / ptrHandle->slotSize);
+        ptrHandle->ptrBitmap[memPool_bitmapWord (idx)] &= ~memPool_bitmapMask (idx);
+    }
+
+    /* Succeed and slot handles enabled? */
+    if ((ret == MEM_POOL_OK) && (ptrHandle->ptrGen != NULL))
+    {
+        uint32_t idx;
+
+        /* New generation: handles of the slot are stale (0 is skipped). */
+        idx = (uint32_t) ((uintptr_t) (ptrSlot - ptrHandle->ptrStorage) / ptrHandle->slotSize);
+        ptrHandle->ptrGen[idx]++;
 
-        while ((ret == MEM_POOL_OK) && (ptr != NULL))
+        if ((ptrHandle->ptrGen[idx] & MEM_POOL_HANDLE_GEN_MASK) == 0U)
         {
-            memPool_assert (ptr != ptrSlot);
+            ptrHandle->ptrGen[idx]++;
+        }
+    }
 
-            /* Same address? */
-            if (ptr != ptrSlot)
-            {
-                /* Update pointer. */
-                ptr = *((uint8_t**) ptr);
-            }
-            else
-            {
-                /* Error! Slow was not allocated! */
-                ret = MEM_POOL_ERROR_SLOT_NOT_ALLOCATED;
-            }
+    /* Return the function result code. */
+    return ret;
+}
+
+/**
+ * @brief Check a freed slot about to be handed out again (debug mode): is the
+ *        poison pattern (zeros, if cleared since) intact?
+ *
+ * Slots written after free are counted; caller quarantines them. Unless
+ * \p commit, slot is left as found (poisoned, not counted): allocation may
+ * still be given up.
+ *
+ * @return true if slot is intact (or not checked); false otherwise.
+ */
+static bool
+memPool_debugAlloc (memPool_handle_t* ptrHandle, uint8_t* ptrSlot, uint32_t origin, bool commit)
+{
+    bool intact;
+
+    /* Intact, unless shown otherwise. */
+    intact = true;
+
+#if (defined MEM_POOL_DEBUG && (MEM_POOL_DEBUG == 1))
+    if ((ptrHandle->debugFlags & MEM_POOL_DEBUG_POISON) != 0U)
+    {
+        uint32_t link;
+        uint8_t  expected;
+        uint32_t i;
+
+        /* Link word (if any) is not poisoned. */
+        link     = (ptrHandle->ptrIndex != NULL) ? 0U : (uint32_t) sizeof (uint8_t*);
+        expected = (uint8_t) MEM_POOL_POISON_BYTE;
+
+    #if (defined memPool_zeroize && (memPool_zeroize == 1))
+        /* Cleared on free, or by memPool_zeroDirty? */
+        if ((origin == MEM_POOL_FROM_LIST) &&
+            ((ptrHandle->zeroPolicy == MEM_POOL_ZERO_ON_FREE) || (ptrHandle->zeroPolicy == MEM_POOL_ZERO_DEFERRED)))
+        {
+            expected = 0x00U;
         }
+    #else
+        (void) origin;
+    #endif /* memPool_zeroize && (memPool_zeroize == 1) */
 
-        /* Succeed? */
-        if (ret == MEM_POOL_OK)
+        /* Slot readable (sanitizer). */
+        memPool_asanUnpoison (ptrSlot, ptrHandle->slotSize);
+
+        for (i = link; (i < ptrHandle->slotSize) && intact; i++)
         {
-            /* No slots available at the moment? */
-            if (ptrHandle->ptrHead == NULL)
-            {
-                /* Just do nothing. */
-            }
-            else
-            {
-                /* Set item freed to point to current head of the list. */
-                *((uint8_t**) ptrSlot) = ptrHandle->ptrHead;
-            }
+            intact = (ptrSlot[i] == expected);
+        }
 
-            /* Slot freed is the new head. */
-            ptrHandle->ptrHead = ptrSlot;
+        if (commit == true)
+        {
+            /* Count corrupted slots. */
+            ptrHandle->corruptions += intact ? 0U : 1U;
         }
         else
         {
-            /* Just do nothing. */
+            /* Free slot off limits again (sanitizer), but its link word. */
+            memPool_asanPoison (&ptrSlot[link], (ptrHandle->slotSize - link));
+        }
+    }
+#else
+    (void) ptrHandle;
+    (void) ptrSlot;
+    (void) origin;
+    (void) commit;
+#endif /* MEM_POOL_DEBUG && (MEM_POOL_DEBUG == 1) */
+
+    /* Return whether slot is intact. */
+    return intact;
+}
+
+/**
+ * @brief Check a slot being freed (debug mode): is the canary intact? Then
+ *        poison it (but the link word).
+ *
+ * Overflowed slots are counted and left untouched; caller quarantines them.
+ *
+ * @return true if slot is intact (or not checked); false otherwise.
+ */
+static bool
+memPool_debugFree (memPool_handle_t* ptrHandle, uint8_t* ptrSlot)
+{
+    bool intact;
+
+    /* Intact, unless shown otherwise. */
+    intact = true;
+
+#if (defined MEM_POOL_DEBUG && (MEM_POOL_DEBUG == 1))
+    if ((ptrHandle->debugFlags & MEM_POOL_DEBUG_CANARY) != 0U)
+    {
+        uint32_t i;
+
+        /* Canary readable (sanitizer). */
+        memPool_asanUnpoison (&ptrSlot[(ptrHandle->slotSize - MEM_POOL_CANARY_SIZE)], MEM_POOL_CANARY_SIZE);
+
+        for (i = (ptrHandle->slotSize - MEM_POOL_CANARY_SIZE); (i < ptrHandle->slotSize) && intact; i++)
+        {
+            intact = (ptrSlot[i] == (uint8_t) MEM_POOL_CANARY_BYTE);
         }
+
+        /* Count corrupted slots. */
+        ptrHandle->corruptions += intact ? 0U : 1U;
+    }
+
+    if (intact && ((ptrHandle->debugFlags & MEM_POOL_DEBUG_POISON) != 0U))
+    {
+        uint32_t link;
+
+        /* Poison (link word, if any, is written when linked). */
+        link = (ptrHandle->ptrIndex != NULL) ? 0U : (uint32_t) sizeof (uint8_t*);
+        (void) memset (&ptrSlot[link], (int) MEM_POOL_POISON_BYTE, (ptrHandle->slotSize - link));
     }
+#else
+    (void) ptrHandle;
+    (void) ptrSlot;
+#endif /* MEM_POOL_DEBUG && (MEM_POOL_DEBUG == 1) */
 
+    /* Return whether slot is intact. */
+    return intact;
+}
+
+#if (defined memPool_zeroize && (memPool_zeroize == 1))
+/**
+ * @brief Clear memory, with non-temporal stores if large enough (and
+ *        supported); caller fences (see \ref MEM_POOL_ZERO_STREAM_MIN).
+ */
+static void
+memPool_clear (uint8_t* ptr, uint32_t size)
+{
+    uint32_t done;
+
+    /* Nothing cleared yet. */
+    done = 0U;
+
+#if (MEM_POOL_ZERO_STREAM == 1)
+    if ((size >= MEM_POOL_ZERO_STREAM_MIN) && (size >= 32U))
+    {
+        uint32_t head;
+        uint32_t i;
+
+        /* Bytes up to first 16-byte boundary, then whole 16-byte blocks. */
+        head = (uint32_t) ((16U - (((uintptr_t) ptr) & 15U)) & 15U);
+        done = head + ((size - head) & ~15U);
+
+        (void) memset (ptr, 0x00, head);
+
+        for (i = head; i < done; i += 16U)
+        {
+            _mm_stream_si128 ((__m128i*) &ptr[i], _mm_setzero_si128 ());
+        }
+    }
+#endif /* MEM_POOL_ZERO_STREAM == 1 */
+
+    /* Remaining bytes (all of them, if small). */
+    (void) memset (&ptr[done], 0x00, (size - done));
+}
+#endif /* memPool_zeroize && (memPool_zeroize == 1) */
+
+/**
+ * @brief Take a slot (as \ref memPool_allocZeroed, not traced nor asserted).
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+static memPool_error_t
+memPool_take (memPool_handle_t* ptrHandle, uint8_t** ptr2Slot, bool* ptrZeroed)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrHandle != NULL) && (ptr2Slot != NULL));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrHandle != NULL) && (ptr2Slot != NULL))
+    {
+        uint32_t origin;
+        bool     zeroed;
+
+        /* Out-of-band free list not empty? */
+        if (ptrHandle->indexTop != 0U)
+        {
+            /* Pop top of the stack (slot untouched). */
+            ptrHandle->indexTop--;
+            *ptr2Slot = &ptrHandle->ptrStorage[(((uint32_t) ptrHandle->ptrIndex[ptrHandle->indexTop]) *
+                                                ptrHandle->slotSize)];
+            origin    = MEM_POOL_FROM_LIST;
+
+            /* Succeed! */
+            ret = MEM_POOL_OK;
+        }
+        /* Free list not empty? */
+        else if (ptrHandle->ptrHead != NULL)
+        {
+            /* Pop head. */
+            *ptr2Slot = memPool_pop (&ptrHandle->ptrHead);
+            origin    = MEM_POOL_FROM_LIST;
+
+            /* Succeed! */
+            ret = MEM_POOL_OK;
+        }
+#if (defined memPool_zeroize && (memPool_zeroize == 1))
+        /* Slots not cleared yet (deferred policy)? */
+        else if (ptrHandle->ptrDirty != NULL)
+        {
+            /* Pop head (handed out as is). */
+            *ptr2Slot = memPool_pop (&ptrHandle->ptrDirty);
+            origin    = MEM_POOL_FROM_DIRTY;
+
+            /* Succeed! */
+            ret = MEM_POOL_OK;
+        }
+#endif /* memPool_zeroize && (memPool_zeroize == 1) */
+        /* Slots never handed out left? */
+        else if (ptrHandle->bumpIndex < ptrHandle->slotNumber)
+        {
+            /* Take slot from bump pointer. */
+            *ptr2Slot = &ptrHandle->ptrStorage[(ptrHandle->bumpIndex * ptrHandle->slotSize)];
+            origin    = MEM_POOL_FROM_BUMP;
+            ptrHandle->bumpIndex++;
+
+            /* Succeed! */
+            ret = MEM_POOL_OK;
+        }
+        else
+        {
+            /* Clear pointer. */
+            *ptr2Slot = NULL;
+            origin    = MEM_POOL_FROM_LIST;
+
+            /* Update statistics (if defined). */
+            memPool_statsAdd (&ptrHandle->stats, allocFailures, 1U);
+
+            /* Error! No free slots! */
+            ret = MEM_POOL_ERROR_SPACE;
+        }
+
+        /* Freed slot written since (debug mode)? Slot quarantined: never handed out again. */
+        if ((ret    == MEM_POOL_OK)        &&
+            (origin != MEM_POOL_FROM_BUMP) &&
+            !memPool_debugAlloc (ptrHandle, *ptr2Slot, origin, true))
+        {
+            /* Clear pointer. */
+            *ptr2Slot = NULL;
+
+            /* Update statistics (if defined). */
+            memPool_statsAdd (&ptrHandle->stats, allocFailures, 1U);
+
+            /* Error! Slot was corrupted! */
+            ret = MEM_POOL_ERROR_CORRUPTED;
+        }
+
+        /* Succeed? Finalize allocation. */
+        zeroed = (ret == MEM_POOL_OK) ? memPool_allocated (ptrHandle, *ptr2Slot, origin) : false;
+
+        /* Report slot clearing (if requested). */
+        if (ptrZeroed != NULL)
+        {
+            *ptrZeroed = zeroed;
+        }
+    }
+
+    /* Return the function result code (asserted by caller). */
+    return ret;
+}
+
+/* ************************************************************************** *
+ *                      End of private function section                       *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                      Start of global function section                      *
+ * ************************************************************************** */
+
+memPool_error_t
+memPool_init (memPool_handle_t* ptrHandle,
+              uint8_t*          ptrStorage,
+              uint32_t          slotSize,
+              uint32_t          slotNumber)
+{
+    /* Same as bitmap init, with no bitmap. */
+    return memPool_initBitmap (ptrHandle, ptrStorage, NULL, slotSize, slotNumber);
+}
+
+memPool_error_t
+memPool_initBitmap (memPool_handle_t* ptrHandle,
+                    uint8_t*          ptrStorage,
+                    uint32_t*         ptrBitmap,
+                    uint32_t          slotSize,
+                    uint32_t          slotNumber)
+{
+    /* Same as index init, with intrusive free list. */
+    return memPool_initIndex (ptrHandle, ptrStorage, ptrBitmap, NULL, slotSize, slotNumber);
+}
+
+memPool_error_t
+memPool_initIndex (memPool_handle_t* ptrHandle,
+                   uint8_t*          ptrStorage,
+                   uint32_t*         ptrBitmap,
+                   memPool_index_t*  ptrIndex,
+                   uint32_t          slotSize,
+                   uint32_t          slotNumber)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrHandle  != NULL)                                          &&
+                    (ptrStorage != NULL)                                          &&
+                    (slotSize   >= ((ptrIndex != NULL) ? 1U : sizeof (uint8_t*))) &&
+                    (slotNumber != 0U)                                            &&
+                    ((ptrIndex  == NULL) || ((slotNumber - 1U) <= MEM_POOL_INDEX_MAX)));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrHandle  != NULL)                                          &&
+                        (ptrStorage != NULL)                                          &&
+                        (slotSize   >= ((ptrIndex != NULL) ? 1U : sizeof (uint8_t*))) &&
+                        (slotNumber != 0U)                                            &&
+                        ((ptrIndex  == NULL) || ((slotNumber - 1U) <= MEM_POOL_INDEX_MAX)))
+    {
+        /* Clear pool. */
+        (void) memset (ptrHandle, 0x00, sizeof (*ptrHandle));
+
+        /* Bitmap supplied? */
+        if (ptrBitmap != NULL)
+        {
+            /* No slots allocated. */
+            (void) memset (ptrBitmap, 0x00, (MEM_POOL_BITMAP_WORDS (slotNumber) * sizeof (*ptrBitmap)));
+        }
+
+        /*
+         * Copy pool info. Storage is not touched: slots are handed out by the
+         * bump pointer first and join the free list only once freed.
+         */
+        ptrHandle->ptrHead    = NULL;
+        ptrHandle->ptrStorage = ptrStorage;
+        ptrHandle->ptrBitmap  = ptrBitmap;
+        ptrHandle->ptrIndex   = ptrIndex;
+        ptrHandle->indexTop   = 0U;
+        ptrHandle->slotSize   = slotSize;
+        ptrHandle->slotNumber = slotNumber;
+        ptrHandle->bumpIndex  = 0U;
+        ptrHandle->bumpHigh   = 0U;
+
+        /* Succeed! */
+        ret = MEM_POOL_OK;
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPool_initAligned (memPool_handle_t* ptrHandle,
+                     uint8_t*          ptrStorage,
+                     uint32_t          storageSize,
+                     uint32_t*         ptrBitmap,
+                     uint32_t          slotSize,
+                     uint32_t          alignment,
+                     uint32_t*         ptrSlotNumber)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrStorage    != NULL) &&
+                    (ptrSlotNumber != NULL) &&
+                    (alignment     != 0U)   &&
+                    ((alignment & (alignment - 1U)) == 0U));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrStorage    != NULL) &&
+                        (ptrSlotNumber != NULL) &&
+                        (alignment     != 0U)   &&
+                        ((alignment & (alignment - 1U)) == 0U))
+    {
+        uint32_t padding;
+        uint32_t stride;
+
+        /* Padding to align first slot, stride to keep next ones aligned. */
+        padding = (uint32_t) ((alignment - (((uintptr_t) ptrStorage) & (alignment - 1U))) & (alignment - 1U));
+        stride  = MEM_POOL_ALIGNED_STRIDE (slotSize, alignment);
+
+        /* Usable slots after padding. */
+        *ptrSlotNumber = ((storageSize > padding) && (stride != 0U)) ? ((storageSize - padding) / stride) : 0U;
+
+        /* Initialize pool on aligned storage (slot size & number checked). */
+        ret = memPool_initBitmap (ptrHandle, &ptrStorage[padding], ptrBitmap, stride, *ptrSlotNumber);
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPool_alloc (memPool_handle_t* ptrHandle, uint8_t** ptr2Slot)
+{
+    memPool_error_t ret;
+
+    /* Same as alloc reporting slot clearing, with no report. */
+    ret = memPool_take (ptrHandle, ptr2Slot, NULL);
+
+    /* Trace allocation (if defined). */
+    memPool_trace (ret, MEM_POOL_TRACE_ALLOC, ptrHandle, *ptr2Slot, memPool_caller ());
+
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPool_allocZeroed (memPool_handle_t* ptrHandle, uint8_t** ptr2Slot, bool* ptrZeroed)
+{
+    memPool_error_t ret;
+
+    /* Take a slot, report slot clearing (if requested). */
+    ret = memPool_take (ptrHandle, ptr2Slot, ptrZeroed);
+
+    /* Trace allocation (if defined). */
+    memPool_trace (ret, MEM_POOL_TRACE_ALLOC, ptrHandle, *ptr2Slot, memPool_caller ());
+
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPool_tryAlloc (memPool_handle_t* ptrHandle, uint8_t** ptr2Slot)
+{
+    /* Alloc on behalf of our caller. */
+    return memPool_allocFrom (ptrHandle, ptr2Slot, memPool_caller ());
+}
+
+memPool_error_t
+memPool_allocFrom (memPool_handle_t* ptrHandle, uint8_t** ptr2Slot, const void* ptrCaller)
+{
+    memPool_error_t ret;
+
+    /* Same as alloc, exhausted pool expected by caller. */
+    ret = memPool_take (ptrHandle, ptr2Slot, NULL);
+
+    /* Trace allocation (if defined). */
+    memPool_trace (ret, MEM_POOL_TRACE_ALLOC, ptrHandle, *ptr2Slot, ptrCaller);
+
+    memPool_assert ((ret == MEM_POOL_OK) || (ret == MEM_POOL_ERROR_SPACE));
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPool_free (memPool_handle_t* ptrHandle, uint8_t* ptrSlot)
+{
+    /* Free on behalf of our caller. */
+    return memPool_freeFrom (ptrHandle, ptrSlot, memPool_caller ());
+}
+
+memPool_error_t
+memPool_freeFrom (memPool_handle_t* ptrHandle, uint8_t* ptrSlot, const void* ptrCaller)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrHandle != NULL) && (ptrSlot != NULL));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrHandle != NULL) && (ptrSlot != NULL))
+    {
+        /* Check that slot was allocated (and mark it as freed). */
+        ret = memPool_release (ptrHandle, ptrSlot);
+
+        /* Succeed? */
+        if (ret == MEM_POOL_OK)
+        {
+            /* Slot freed is the new head. */
+            memPool_push (ptrHandle, ptrSlot);
+        }
+        else
+        {
+            /* Just do nothing. */
+        }
+
+        /* Trace free (if defined). */
+        memPool_trace (ret, MEM_POOL_TRACE_FREE, ptrHandle, ptrSlot, ptrCaller);
+    }
+
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPool_allocBulk (memPool_handle_t* ptrHandle, uint8_t** ptrArray, uint32_t count, uint32_t* ptrGot)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrHandle != NULL) && (ptrArray != NULL));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrHandle != NULL) && (ptrArray != NULL))
+    {
+        uint8_t* ptrHead;
+        uint8_t* ptrDirty;
+        uint32_t indexTop;
+        uint32_t bumpIndex;
+        uint32_t fromIndex;
+        uint32_t fromList;
+        uint32_t fromDirty;
+        uint32_t popped;
+        uint32_t i;
+
+        /* Work on local copies: pool is updated once, on success only. */
+        ptrHead   = ptrHandle->ptrHead;
+    #if (defined memPool_zeroize && (memPool_zeroize == 1))
+        ptrDirty  = ptrHandle->ptrDirty;
+    #else
+        ptrDirty  = NULL;
+    #endif /* memPool_zeroize && (memPool_zeroize == 1) */
+        indexTop  = ptrHandle->indexTop;
+        bumpIndex = ptrHandle->bumpIndex;
+        popped    = 0U;
+        i         = 0U;
+
+        /*
+         * Pop slots from out-of-band free list. Slots written after free
+         * (debug mode) are skipped: quarantined if committed. Slots are only
+         * checked here: debug bookkeeping is done once the batch is committed.
+         */
+        while ((i < count) && (indexTop != 0U))
+        {
+            indexTop--;
+            ptrArray[i] = &ptrHandle->ptrStorage[(((uint32_t) ptrHandle->ptrIndex[indexTop]) * ptrHandle->slotSize)];
+            popped++;
+            i += memPool_debugAlloc (ptrHandle, ptrArray[i], MEM_POOL_FROM_LIST, false) ? 1U : 0U;
+        }
+
+        fromIndex = i;
+
+        /* Unlink a chain from the free list. */
+        while ((i < count) && (ptrHead != NULL))
+        {
+            ptrArray[i] = ptrHead;
+            ptrHead     = *((uint8_t**) ptrHead);
+            popped++;
+            i += memPool_debugAlloc (ptrHandle, ptrArray[i], MEM_POOL_FROM_LIST, false) ? 1U : 0U;
+        }
+
+        fromList = i;
+
+        /* Then from slots not cleared yet (deferred policy). */
+        while ((i < count) && (ptrDirty != NULL))
+        {
+            ptrArray[i] = ptrDirty;
+            ptrDirty    = *((uint8_t**) ptrDirty);
+            popped++;
+            i += memPool_debugAlloc (ptrHandle, ptrArray[i], MEM_POOL_FROM_DIRTY, false) ? 1U : 0U;
+        }
+
+        fromDirty = i;
+
+        /* Take remaining slots from bump pointer. */
+        while ((i < count) && (bumpIndex < ptrHandle->slotNumber))
+        {
+            ptrArray[i] = &ptrHandle->ptrStorage[(bumpIndex * ptrHandle->slotSize)];
+            bumpIndex++;
+            i++;
+        }
+
+        /* All slots, or best effort? */
+        if ((i == count) || (ptrGot != NULL))
+        {
+            uint32_t j;
+
+            /* Commit. */
+            ptrHandle->ptrHead   = ptrHead;
+            ptrHandle->indexTop  = indexTop;
+        #if (defined memPool_zeroize && (memPool_zeroize == 1))
+            ptrHandle->ptrDirty  = ptrDirty;
+        #endif /* memPool_zeroize && (memPool_zeroize == 1) */
+            ptrHandle->bumpIndex = bumpIndex;
+
+        #if (defined MEM_POOL_DEBUG && (MEM_POOL_DEBUG == 1))
+            /* Count corrupted slots skipped (quarantined). */
+            ptrHandle->corruptions += (popped - fromDirty);
+        #else
+            (void) popped;
+        #endif /* MEM_POOL_DEBUG && (MEM_POOL_DEBUG == 1) */
+
+            for (j = 0U; j < i; j++)
+            {
+                /* Clear next (intrusive lists only). */
+                if ((j >= fromIndex) && (j < fromDirty))
+                {
+                    *((uint8_t**) ptrArray[j]) = NULL;
+                }
+
+                /* Finalize allocation. */
+                (void) memPool_allocated (ptrHandle, ptrArray[j],
+                                          ((j < fromList) ? MEM_POOL_FROM_LIST :
+                                           ((j < fromDirty) ? MEM_POOL_FROM_DIRTY : MEM_POOL_FROM_BUMP)));
+            }
+        }
+        else
+        {
+            /* Nothing allocated. */
+            i = 0U;
+        }
+
+        /* Clear unused entries. */
+        (void) memset (&ptrArray[i], 0x00, ((count - i) * sizeof (*ptrArray)));
+
+        /* Store number of slots allocated. */
+        if (ptrGot != NULL)
+        {
+            *ptrGot = i;
+        }
+
+        /* Succeed if all slots (best effort: any slot) were allocated. */
+        ret = ((i == count) || ((i != 0U) && (ptrGot != NULL))) ? MEM_POOL_OK : MEM_POOL_ERROR_SPACE;
+
+        /* Update statistics (if defined). */
+        memPool_statsAdd (&ptrHandle->stats, allocFailures, ((ret == MEM_POOL_OK) ? 0U : 1U));
+    }
+
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPool_freeBulk (memPool_handle_t* ptrHandle, uint8_t* const* ptrArray, uint32_t count)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrHandle != NULL) && (ptrArray != NULL));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrHandle != NULL) && (ptrArray != NULL))
+    {
+        uint32_t i;
+
+        /* Clear error code. */
+        ret = MEM_POOL_OK;
+
+        for (i = 0U; i < count; i++)
+        {
+            memPool_error_t result;
+
+            /* Check that slot was allocated (and mark it as freed). */
+            result = (ptrArray[i] != NULL) ? memPool_release (ptrHandle, ptrArray[i]) :
+                                             MEM_POOL_ERROR_SLOT_NOT_ALLOCATED;
+
+            if (result == MEM_POOL_OK)
+            {
+                /* Slot freed is the new head. */
+                memPool_push (ptrHandle, ptrArray[i]);
+            }
+            else
+            {
+                /* Error! Slot skipped (first error reported)! */
+                ret = (ret == MEM_POOL_OK) ? result : ret;
+            }
+        }
+    }
+
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPool_setGenerations (memPool_handle_t* ptrHandle, uint32_t* ptrGen)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrHandle != NULL)               &&
+                    (ptrGen    != NULL)               &&
+                    (ptrHandle->bumpIndex == 0U)      &&
+                    ((ptrHandle->slotNumber - 1U) <= MEM_POOL_HANDLE_INDEX_MASK));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrHandle != NULL)               &&
+                        (ptrGen    != NULL)               &&
+                        (ptrHandle->bumpIndex == 0U)      &&
+                        ((ptrHandle->slotNumber - 1U) <= MEM_POOL_HANDLE_INDEX_MASK))
+    {
+        /* Slots handed out before a reset are bumped again: clear them (kept if same array). */
+        if (ptrGen != ptrHandle->ptrGen)
+        {
+            (void) memset (ptrGen, 0x00, (ptrHandle->bumpHigh * sizeof (*ptrGen)));
+        }
+
+        /* Generations of other slots are set when handed out for the first time. */
+        ptrHandle->ptrGen = ptrGen;
+
+        /* Succeed! */
+        ret = MEM_POOL_OK;
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPool_allocHandle (memPool_handle_t* ptrHandle, memPool_slotHandle_t* ptrSlotHandle, uint8_t** ptr2Slot)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrHandle != NULL) && (ptrSlotHandle != NULL) && (ptrHandle->ptrGen != NULL));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrHandle != NULL) && (ptrSlotHandle != NULL) && (ptrHandle->ptrGen != NULL))
+    {
+        uint8_t* ptrSlot;
+
+        ret = memPool_allocFrom (ptrHandle, &ptrSlot, memPool_caller ());
+
+        if (ret == MEM_POOL_OK)
+        {
+            uint32_t idx;
+
+            /* Slot index and current generation. */
+            idx            = (uint32_t) ((uintptr_t) (ptrSlot - ptrHandle->ptrStorage) / ptrHandle->slotSize);
+            *ptrSlotHandle = (((memPool_slotHandle_t) (ptrHandle->ptrGen[idx] & MEM_POOL_HANDLE_GEN_MASK))
+                              << MEM_POOL_HANDLE_INDEX) | idx;
+        }
+        else
+        {
+            /* Clear handle. */
+            *ptrSlotHandle = MEM_POOL_SLOT_HANDLE_NULL;
+        }
+
+        /* Store slot address (if requested). */
+        if (ptr2Slot != NULL)
+        {
+            *ptr2Slot = ptrSlot;
+        }
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPool_resolve (const memPool_handle_t* ptrHandle, memPool_slotHandle_t slotHandle, uint8_t** ptr2Slot)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrHandle != NULL) && (ptr2Slot != NULL) && (ptrHandle->ptrGen != NULL));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrHandle != NULL) && (ptr2Slot != NULL) && (ptrHandle->ptrGen != NULL))
+    {
+        uint32_t idx;
+
+        /* Slot index. */
+        idx = (uint32_t) (slotHandle & MEM_POOL_HANDLE_INDEX_MASK);
+
+        /* Slot handed out, same generation (and allocated, if bitmap)? */
+        if ((idx < ptrHandle->bumpIndex)                                                                          &&
+            ((ptrHandle->ptrGen[idx] & MEM_POOL_HANDLE_GEN_MASK) == (uint32_t) (slotHandle >> MEM_POOL_HANDLE_INDEX)) &&
+            ((ptrHandle->ptrBitmap == NULL)                                                                       ||
+             ((ptrHandle->ptrBitmap[memPool_bitmapWord (idx)] & memPool_bitmapMask (idx)) != 0U)))
+        {
+            /* Index to address. */
+            *ptr2Slot = &ptrHandle->ptrStorage[(idx * ptrHandle->slotSize)];
+
+            /* Succeed! */
+            ret = MEM_POOL_OK;
+        }
+        else
+        {
+            /* Clear pointer. */
+            *ptr2Slot = NULL;
+
+            /* Error! Stale or invalid handle! */
+            ret = MEM_POOL_ERROR_SLOT_NOT_ALLOCATED;
+        }
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPool_freeHandle (memPool_handle_t* ptrHandle, memPool_slotHandle_t slotHandle)
+{
+    memPool_error_t ret;
+    uint8_t*        ptrSlot;
+
+    /* Resolve handle (stale handles rejected), then free slot. */
+    ret = memPool_resolve (ptrHandle, slotHandle, &ptrSlot);
+
+    if (ret == MEM_POOL_OK)
+    {
+        ret = memPool_freeFrom (ptrHandle, ptrSlot, memPool_caller ());
+    }
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPool_forEachAllocated (memPool_handle_t* ptrHandle, memPool_visit_t visit, void* ptrContext)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrHandle != NULL) && (visit != NULL) && (ptrHandle->ptrBitmap != NULL));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrHandle != NULL) && (visit != NULL) && (ptrHandle->ptrBitmap != NULL))
+    {
+        uint32_t words;
+        uint32_t word;
+        uint32_t w;
+
+        /* Only slots below the bump pointer can be allocated. */
+        words = MEM_POOL_BITMAP_WORDS (ptrHandle->bumpIndex);
+        w     = 0U;
+
+        while (w < words)
+        {
+        #if (defined __SSE2__)
+            /* Skip 4 free words (128 slots) at once. */
+            while (((w + 4U) <= words) &&
+                   (_mm_movemask_epi8 (_mm_cmpeq_epi32 (_mm_loadu_si128 ((const __m128i*) &ptrHandle->ptrBitmap[w]),
+                                                        _mm_setzero_si128 ())) == 0xFFFF))
+            {
+                w += 4U;
+            }
+        #endif /* __SSE2__ */
+
+            if (w < words)
+            {
+                /* Snapshot: visit may free (clear) the slot visited. */
+                word = ptrHandle->ptrBitmap[w];
+
+                while (word != 0U)
+                {
+                    /* Lowest allocated slot left in word. */
+                    visit (ptrContext,
+                           &ptrHandle->ptrStorage[(((w << 5U) + memPool_bitmapLowest (word)) * ptrHandle->slotSize)]);
+                    word &= (word - 1U);
+                }
+
+                w++;
+            }
+        }
+
+        /* Succeed! */
+        ret = MEM_POOL_OK;
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPool_reset (memPool_handle_t* ptrHandle)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert (ptrHandle != NULL);
+
+    /* Check parameters (if defined). */
+    memPool_checkParam (ptrHandle != NULL)
+    {
+        /* Bitmap supplied? */
+        if (ptrHandle->ptrBitmap != NULL)
+        {
+            /* No slots allocated (above bump pointer: none already). */
+            (void) memset (ptrHandle->ptrBitmap, 0x00,
+                           (MEM_POOL_BITMAP_WORDS (ptrHandle->bumpIndex) * sizeof (*ptrHandle->ptrBitmap)));
+        }
+
+        /* Slots below keep a generation (slot handles). */
+        if (ptrHandle->bumpIndex > ptrHandle->bumpHigh)
+        {
+            ptrHandle->bumpHigh = ptrHandle->bumpIndex;
+        }
+
+        /* Empty lists: all slots handed out by the bump pointer again. */
+        ptrHandle->ptrHead   = NULL;
+        ptrHandle->indexTop  = 0U;
+    #if (defined memPool_zeroize && (memPool_zeroize == 1))
+        ptrHandle->ptrDirty  = NULL;
+    #endif /* memPool_zeroize && (memPool_zeroize == 1) */
+        ptrHandle->bumpIndex = 0U;
+
+        /* Update statistics (if defined). */
+        memPool_statsAdd (&ptrHandle->stats, frees, ptrHandle->stats.inUse);
+        memPool_statsSub (&ptrHandle->stats, inUse, ptrHandle->stats.inUse);
+
+    #if (defined MEM_POOL_DEBUG && (MEM_POOL_DEBUG == 1))
+        if ((ptrHandle->debugFlags & MEM_POOL_DEBUG_POISON) != 0U)
+        {
+            /* Slots never handed out off limits (sanitizer). */
+            memPool_asanPoison (ptrHandle->ptrStorage, (((size_t) ptrHandle->slotSize) * ptrHandle->slotNumber));
+        }
+    #endif /* MEM_POOL_DEBUG && (MEM_POOL_DEBUG == 1) */
+
+        /* Succeed! */
+        ret = MEM_POOL_OK;
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPool_compactFreeList (memPool_handle_t* ptrHandle, uint32_t* ptrScratch)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrHandle != NULL) && (ptrScratch != NULL));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrHandle != NULL) && (ptrScratch != NULL))
+    {
+        uint8_t** ptr2Link;
+        uint8_t*  ptrSlot;
+        uint32_t  words;
+        uint32_t  word;
+        uint32_t  idx;
+        uint32_t  k;
+        uint32_t  w;
+
+        /* Only slots below the bump pointer can be free. */
+        words = MEM_POOL_BITMAP_WORDS (ptrHandle->bumpIndex);
+        (void) memset (ptrScratch, 0x00, (words * sizeof (*ptrScratch)));
+
+        /* Mark free slots. */
+        for (k = 0U; k < ptrHandle->indexTop; k++)
+        {
+            idx = (uint32_t) ptrHandle->ptrIndex[k];
+            ptrScratch[memPool_bitmapWord (idx)] |= memPool_bitmapMask (idx);
+        }
+
+        for (ptrSlot = ptrHandle->ptrHead; ptrSlot != NULL; ptrSlot = *((uint8_t**) ptrSlot))
+        {
+            idx = (uint32_t) ((uintptr_t) (ptrSlot - ptrHandle->ptrStorage) / ptrHandle->slotSize);
+            ptrScratch[memPool_bitmapWord (idx)] |= memPool_bitmapMask (idx);
+        }
+
+        /* Rebuild, lowest address first (top of the stack, or head of the list). */
+        ptr2Link = &ptrHandle->ptrHead;
+        k        = ptrHandle->indexTop;
+
+        for (w = 0U; w < words; w++)
+        {
+            word = ptrScratch[w];
+
+            while (word != 0U)
+            {
+                /* Lowest free slot left in word. */
+                idx  = (w << 5U) + memPool_bitmapLowest (word);
+                word &= (word - 1U);
+
+                if (ptrHandle->ptrIndex != NULL)
+                {
+                    k--;
+                    ptrHandle->ptrIndex[k] = (memPool_index_t) idx;
+                }
+                else
+                {
+                    ptrSlot   = &ptrHandle->ptrStorage[(idx * ptrHandle->slotSize)];
+                    *ptr2Link = ptrSlot;
+                    ptr2Link  = (uint8_t**) ptrSlot;
+
+                #if (defined MEM_POOL_FREE_ORDER && (MEM_POOL_FREE_ORDER == 1))
+                    /* Last so far (FIFO tail). */
+                    ptrHandle->ptrTail = ptrSlot;
+                #endif /* MEM_POOL_FREE_ORDER && (MEM_POOL_FREE_ORDER == 1) */
+                }
+            }
+        }
+
+        /* Terminate list. */
+        *ptr2Link = NULL;
+
+        /* Succeed! */
+        ret = MEM_POOL_OK;
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+#if (defined MEM_POOL_FREE_ORDER && (MEM_POOL_FREE_ORDER == 1))
+memPool_error_t
+memPool_setOrder (memPool_handle_t* ptrHandle, memPool_order_t order)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrHandle != NULL)                &&
+                    (order     <= MEM_POOL_ORDER_FIFO) &&
+                    (ptrHandle->bumpIndex == 0U)       &&
+                    ((ptrHandle->ptrIndex == NULL) || (order != MEM_POOL_ORDER_FIFO)));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrHandle != NULL)                &&
+                        (order     <= MEM_POOL_ORDER_FIFO) &&
+                        (ptrHandle->bumpIndex == 0U)       &&
+                        ((ptrHandle->ptrIndex == NULL) || (order != MEM_POOL_ORDER_FIFO)))
+    {
+        /* Set order (no slot handed out yet: list is empty). */
+        ptrHandle->order = order;
+
+        /* Succeed! */
+        ret = MEM_POOL_OK;
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+#endif /* MEM_POOL_FREE_ORDER && (MEM_POOL_FREE_ORDER == 1) */
+
+#if (defined MEM_POOL_DEBUG && (MEM_POOL_DEBUG == 1))
+memPool_error_t
+memPool_setDebug (memPool_handle_t* ptrHandle, uint32_t debugFlags)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrHandle  != NULL)                                                &&
+                    ((debugFlags & ~(MEM_POOL_DEBUG_POISON | MEM_POOL_DEBUG_CANARY)) == 0U) &&
+                    (ptrHandle->bumpIndex == 0U)                                        &&
+                    (((debugFlags & MEM_POOL_DEBUG_CANARY) == 0U) ||
+                     (ptrHandle->slotSize >= (MEM_POOL_CANARY_SIZE +
+                                              ((ptrHandle->ptrIndex != NULL) ? 1U : sizeof (uint8_t*))))));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrHandle  != NULL)                                                &&
+                        ((debugFlags & ~(MEM_POOL_DEBUG_POISON | MEM_POOL_DEBUG_CANARY)) == 0U) &&
+                        (ptrHandle->bumpIndex == 0U)                                        &&
+                        (((debugFlags & MEM_POOL_DEBUG_CANARY) == 0U) ||
+                         (ptrHandle->slotSize >= (MEM_POOL_CANARY_SIZE +
+                                                  ((ptrHandle->ptrIndex != NULL) ? 1U : sizeof (uint8_t*))))))
+    {
+        /* Set checks (no slot handed out yet: lists are empty). */
+        ptrHandle->debugFlags = debugFlags;
+
+        if ((debugFlags & MEM_POOL_DEBUG_POISON) != 0U)
+        {
+            /* Slots never handed out off limits (sanitizer). */
+            memPool_asanPoison (ptrHandle->ptrStorage, (((size_t) ptrHandle->slotSize) * ptrHandle->slotNumber));
+        }
+
+        /* Succeed! */
+        ret = MEM_POOL_OK;
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+#endif /* MEM_POOL_DEBUG && (MEM_POOL_DEBUG == 1) */
+
+#if (defined memPool_zeroize && (memPool_zeroize == 1))
+memPool_error_t
+memPool_setZeroPolicy (memPool_handle_t* ptrHandle, memPool_zeroPolicy_t zeroPolicy, uint32_t zeroBytes)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrHandle  != NULL)                  &&
+                    (zeroPolicy <= MEM_POOL_ZERO_PARTIAL) &&
+                    (ptrHandle->bumpIndex == 0U)          &&
+                    ((ptrHandle->ptrIndex == NULL) || (zeroPolicy != MEM_POOL_ZERO_DEFERRED)));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrHandle  != NULL)                  &&
+                        (zeroPolicy <= MEM_POOL_ZERO_PARTIAL) &&
+                        (ptrHandle->bumpIndex == 0U)          &&
+                        ((ptrHandle->ptrIndex == NULL) || (zeroPolicy != MEM_POOL_ZERO_DEFERRED)))
+    {
+        /* Set policy (no slot handed out yet: lists are empty). */
+        ptrHandle->zeroPolicy = zeroPolicy;
+        ptrHandle->zeroBytes  = zeroBytes;
+
+        /* Succeed! */
+        ret = MEM_POOL_OK;
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPool_zeroDirty (memPool_handle_t* ptrHandle, uint32_t maxSlots, uint32_t* ptrCleared)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert (ptrHandle != NULL);
+
+    /* Check parameters (if defined). */
+    memPool_checkParam (ptrHandle != NULL)
+    {
+        uint8_t* ptrSlot;
+        uint32_t n;
+
+        /* Nothing cleared yet. */
+        n = 0U;
+
+        while ((n < maxSlots) && (ptrHandle->ptrDirty != NULL))
+        {
+            /* Unlink from slots to be cleared. */
+            ptrSlot             = ptrHandle->ptrDirty;
+            ptrHandle->ptrDirty = *((uint8_t**) ptrSlot);
+
+            /* Written after free (debug mode)? Slot quarantined: never handed out again. */
+            if (memPool_debugAlloc (ptrHandle, ptrSlot, MEM_POOL_FROM_DIRTY, true))
+            {
+                /* Clear (link word is cleared on pop). */
+                memPool_clear (&ptrSlot[sizeof (uint8_t*)], (ptrHandle->slotSize - (uint32_t) sizeof (uint8_t*)));
+
+                /* Cleared slot joins the free list. */
+                memPool_link (ptrHandle, ptrSlot);
+
+            #if (defined MEM_POOL_DEBUG && (MEM_POOL_DEBUG == 1))
+                if ((ptrHandle->debugFlags & MEM_POOL_DEBUG_POISON) != 0U)
+                {
+                    /* Free slot off limits again (sanitizer), but its link word. */
+                    memPool_asanPoison (&ptrSlot[sizeof (uint8_t*)],
+                                        (ptrHandle->slotSize - (uint32_t) sizeof (uint8_t*)));
+                }
+            #endif /* MEM_POOL_DEBUG && (MEM_POOL_DEBUG == 1) */
+            }
+
+            n++;
+        }
+
+    #if (MEM_POOL_ZERO_STREAM == 1)
+        /* Non-temporal stores are weakly ordered. */
+        _mm_sfence ();
+    #endif /* MEM_POOL_ZERO_STREAM == 1 */
+
+        /* Store number of slots cleared. */
+        if (ptrCleared != NULL)
+        {
+            *ptrCleared = n;
+        }
+
+        /* Succeed! */
+        ret = MEM_POOL_OK;
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+#endif /* memPool_zeroize && (memPool_zeroize == 1) */
+
+#if (defined MEM_POOL_STATS && (MEM_POOL_STATS == 1))
+memPool_error_t
+memPool_getStats (const memPool_handle_t* ptrHandle, memPool_stats_t* ptrStats)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrHandle != NULL) && (ptrStats != NULL));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrHandle != NULL) && (ptrStats != NULL))
+    {
+        /* Copy counters. */
+        *ptrStats = ptrHandle->stats;
+
+        /*
+         * Bump pointer moves only when free list is empty, i.e. when all the
+         * slots handed out so far are allocated: it is the high water mark
+         * (since init, across resets).
+         */
+        ptrStats->highWater = (ptrHandle->bumpIndex > ptrHandle->bumpHigh) ? ptrHandle->bumpIndex : ptrHandle->bumpHigh;
+
+        /* Succeed! */
+        ret = MEM_POOL_OK;
+    }
+
+    /* Assert block (if defined). */
     memPool_assert (ret == MEM_POOL_OK);
 
     /* Return the function result code. */
     return ret;
 }
+#endif /* MEM_POOL_STATS && (MEM_POOL_STATS == 1) */
 
 /* ************************************************************************** *
  *                       End of global function section                       *
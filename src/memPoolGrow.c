@@ -0,0 +1,558 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2021 Alessandro Morniroli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file   memPoolGrow.c
+ * @author Alessandro Morniroli <alessandro.morniroli@gmail.com>
+ * @date   Sun Oct 18 2026
+ *
+ * @brief  Growable memory pool (chained storage chunks) implementation.
+ */
+
+/* ************************************************************************** *
+ *                         Start of includes section                          *
+ * ************************************************************************** */
+
+/* Standard C. */
+#include <stddef.h>
+#include <string.h>
+/* Module include. */
+#include "memPool_priv.h"
+#include "memPoolGrow.h"
+
+/* ************************************************************************** *
+ *                          End of includes section                           *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                    Start of private definitions section                    *
+ * ************************************************************************** */
+
+/**
+ * Chunk header size (rounded up so that slots are aligned as max_align_t).
+ */
+#define MEM_POOL_GROW_HEADER_SIZE \
+    ((uint32_t) (((sizeof (memPoolGrow_chunk_t) + _Alignof (max_align_t)) - 1U) & ~(_Alignof (max_align_t) - 1U)))
+
+/**
+ * Allocation bitmap size (bytes, rounded up as the header; none if unchecked).
+ */
+#if (!defined MEM_POOL_UNCHECKED_FREE || (MEM_POOL_UNCHECKED_FREE == 0))
+    #define MEM_POOL_GROW_BITMAP_SIZE(n)                                                                \
+        ((uint32_t) (((((uint32_t) sizeof (uint32_t)) * MEM_POOL_BITMAP_WORDS (n)) + _Alignof (max_align_t) - 1U) \
+                     & ~(_Alignof (max_align_t) - 1U)))
+    #define MEM_POOL_GROW_BITMAP_BITS 1U
+#else
+    #define MEM_POOL_GROW_BITMAP_SIZE(n) 0U
+    #define MEM_POOL_GROW_BITMAP_BITS    0U
+#endif /* !MEM_POOL_UNCHECKED_FREE || (MEM_POOL_UNCHECKED_FREE == 0) */
+
+/**
+ * Is a chunk usable (aligned, not larger than alignment, room for header, bitmap and one slot)?
+ */
+#define memPoolGrow_chunkFits(pH, ptr, size)                                  \
+    (((((uintptr_t) (ptr)) & (MEM_POOL_GROW_CHUNK_ALIGN - 1U)) == 0U) &&        \
+     ((size) <= MEM_POOL_GROW_CHUNK_ALIGN)                              &&        \
+     ((size) >= (MEM_POOL_GROW_HEADER_SIZE + MEM_POOL_GROW_BITMAP_SIZE (1U) + (pH)->slotSize)))
+
+/**
+ * Chunk being released (shrink marker).
+ */
+#define MEM_POOL_GROW_RELEASE UINT32_MAX
+
+/* ************************************************************************** *
+ *                     End of private definitions section                     *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                    Start of external variables section                     *
+ * ************************************************************************** */
+
+/* ************************************************************************** *
+ *                     End of external variables section                      *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                     Start of private variables section                     *
+ * ************************************************************************** */
+
+/* ************************************************************************** *
+ *                      End of private variables section                      *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                Start of private function prototypes section                *
+ * ************************************************************************** */
+
+static memPoolGrow_chunk_t*
+memPoolGrow_findChunk (const memPoolGrow_handle_t* ptrHandle, const uint8_t* ptrSlot);
+
+static bool
+memPoolGrow_mark (const memPoolGrow_handle_t* ptrHandle,
+                  memPoolGrow_chunk_t*        ptrChunk,
+                  const uint8_t*              ptrSlot,
+                  bool                        allocated);
+
+/* ************************************************************************** *
+ *                 End of private function prototypes section                 *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                     Start of private function section                      *
+ * ************************************************************************** */
+
+/**
+ * @brief Find the chunk a slot belongs to (NULL if none), in O(1).
+ */
+static memPoolGrow_chunk_t*
+memPoolGrow_findChunk (const memPoolGrow_handle_t* ptrHandle, const uint8_t* ptrSlot)
+{
+    memPoolGrow_chunk_t* ptrChunk;
+
+    /* Chunks are aligned on (and not larger than) MEM_POOL_GROW_CHUNK_ALIGN: header is below slot. */
+    ptrChunk = (memPoolGrow_chunk_t*) (((uintptr_t) ptrSlot) & ~((uintptr_t) (MEM_POOL_GROW_CHUNK_ALIGN - 1U)));
+
+    /* Not a chunk of this pool, or not among its slots? */
+    if ((ptrChunk->ptrOwner != ptrHandle) ||
+        ((((uintptr_t) ptrSlot) - ((uintptr_t) ptrChunk->ptrSlots)) >=
+         (((uintptr_t) ptrChunk->slotNumber) * ptrHandle->slotSize)))
+    {
+        ptrChunk = NULL;
+    }
+
+    /* Return the chunk found. */
+    return ptrChunk;
+}
+
+/**
+ * @brief Mark a slot as allocated (or freed) in the bitmap of its chunk.
+ *
+ * @return true if slot changed state (or bitmap not used); false otherwise.
+ */
+static bool
+memPoolGrow_mark (const memPoolGrow_handle_t* ptrHandle,
+                  memPoolGrow_chunk_t*        ptrChunk,
+                  const uint8_t*              ptrSlot,
+                  bool                        allocated)
+{
+    bool changed;
+
+    /* Unchanged only if shown otherwise. */
+    changed = true;
+
+    if (ptrChunk->ptrBitmap != NULL)
+    {
+        uint32_t idx;
+        uint32_t word;
+        uint32_t mask;
+
+        idx  = (uint32_t) (((uintptr_t) (ptrSlot - ptrChunk->ptrSlots)) / ptrHandle->slotSize);
+        word = memPool_bitmapWord (idx);
+        mask = memPool_bitmapMask (idx);
+
+        /* Already in the requested state? */
+        changed = (((ptrChunk->ptrBitmap[word] & mask) != 0U) != allocated);
+
+        ptrChunk->ptrBitmap[word] = allocated ? (ptrChunk->ptrBitmap[word] | mask) :
+                                                (ptrChunk->ptrBitmap[word] & ~mask);
+    }
+
+    /* Return whether slot changed state. */
+    return changed;
+}
+
+/* ************************************************************************** *
+ *                      End of private function section                       *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                      Start of global function section                      *
+ * ************************************************************************** */
+
+memPool_error_t
+memPoolGrow_init (memPoolGrow_handle_t*  ptrHandle,
+                  uint32_t               slotSize,
+                  memPoolGrow_provider_t provider,
+                  memPoolGrow_release_t  release,
+                  void*                  ptrContext)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrHandle != NULL) && (slotSize >= sizeof (uint8_t*)));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrHandle != NULL) && (slotSize >= sizeof (uint8_t*)))
+    {
+        /* No storage yet. */
+        (void) memset (ptrHandle, 0x00, sizeof (*ptrHandle));
+
+        ptrHandle->provider   = provider;
+        ptrHandle->release    = release;
+        ptrHandle->ptrContext = ptrContext;
+        ptrHandle->slotSize   = slotSize;
+
+        /* Succeed! */
+        ret = MEM_POOL_OK;
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPoolGrow_addChunk (memPoolGrow_handle_t* ptrHandle, uint8_t* ptrChunk, uint32_t size)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrHandle != NULL) &&
+                    (ptrChunk  != NULL) &&
+                    memPoolGrow_chunkFits (ptrHandle, ptrChunk, size));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrHandle != NULL) &&
+                        (ptrChunk  != NULL) &&
+                        memPoolGrow_chunkFits (ptrHandle, ptrChunk, size))
+    {
+        memPoolGrow_chunk_t* ptrHeader;
+        uint32_t             room;
+        uint32_t             slotNumber;
+
+        /* Header at the beginning of the chunk, then bitmap (if any), then slots. */
+        ptrHeader = (memPoolGrow_chunk_t*) ptrChunk;
+        room      = size - MEM_POOL_GROW_HEADER_SIZE;
+
+        /* Each slot costs its size plus a bitmap bit: fix bitmap rounding up. */
+        slotNumber = (uint32_t) ((((uint64_t) room) * 8U) /
+                                 ((((uint64_t) ptrHandle->slotSize) * 8U) + MEM_POOL_GROW_BITMAP_BITS));
+
+        while ((MEM_POOL_GROW_BITMAP_SIZE (slotNumber) + (((uint64_t) slotNumber) * ptrHandle->slotSize)) > room)
+        {
+            slotNumber--;
+        }
+
+        ptrHeader->ptrOwner   = ptrHandle;
+        ptrHeader->ptrBitmap  = (MEM_POOL_GROW_BITMAP_BITS != 0U) ?
+                                ((uint32_t*) &ptrChunk[MEM_POOL_GROW_HEADER_SIZE]) : NULL;
+        ptrHeader->ptrSlots   = &ptrChunk[(MEM_POOL_GROW_HEADER_SIZE + MEM_POOL_GROW_BITMAP_SIZE (slotNumber))];
+        ptrHeader->size       = size;
+        ptrHeader->slotNumber = slotNumber;
+        ptrHeader->bumpIndex  = 0U;
+        ptrHeader->freeCount  = 0U;
+
+        /* Nothing allocated yet. */
+        if (ptrHeader->ptrBitmap != NULL)
+        {
+            (void) memset (ptrHeader->ptrBitmap, 0x00, MEM_POOL_GROW_BITMAP_SIZE (slotNumber));
+        }
+
+        /* Newest chunk first: it is the one slots are bumped from. */
+        ptrHeader->ptrNext      = ptrHandle->ptrChunks;
+        ptrHandle->ptrChunks    = ptrHeader;
+        ptrHandle->ptrBumpChunk = ptrHeader;
+
+        /* Succeed! */
+        ret = MEM_POOL_OK;
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPoolGrow_alloc (memPoolGrow_handle_t* ptrHandle, uint8_t** ptr2Slot)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrHandle != NULL) && (ptr2Slot != NULL));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrHandle != NULL) && (ptr2Slot != NULL))
+    {
+        /* Free list not empty (fast path)? */
+        if (ptrHandle->ptrHead != NULL)
+        {
+            /* Current head is the slot allocated. */
+            *ptr2Slot          = ptrHandle->ptrHead;
+            ptrHandle->ptrHead = *((uint8_t**) *ptr2Slot);
+
+        #if (!defined MEM_POOL_UNCHECKED_FREE || (MEM_POOL_UNCHECKED_FREE == 0))
+            /* Mark slot as allocated. */
+            (void) memPoolGrow_mark (ptrHandle, memPoolGrow_findChunk (ptrHandle, *ptr2Slot), *ptr2Slot, true);
+        #endif /* !MEM_POOL_UNCHECKED_FREE || (MEM_POOL_UNCHECKED_FREE == 0) */
+
+            /* Succeed! */
+            ret = MEM_POOL_OK;
+        }
+        else
+        {
+            memPoolGrow_chunk_t* ptrChunk;
+
+            /* Find a chunk with slots never handed out. */
+            ptrChunk = ptrHandle->ptrBumpChunk;
+
+            while ((ptrChunk != NULL) && (ptrChunk->bumpIndex == ptrChunk->slotNumber))
+            {
+                ptrChunk = ptrChunk->ptrNext;
+            }
+
+            /* None: ask provider for a new one. */
+            if ((ptrChunk == NULL) && (ptrHandle->provider != NULL))
+            {
+                uint8_t* ptrStorage;
+                uint32_t size;
+
+                ptrStorage = ptrHandle->provider (ptrHandle->ptrContext, &size);
+
+                if ((ptrStorage != NULL) && memPoolGrow_chunkFits (ptrHandle, ptrStorage, size))
+                {
+                    (void) memPoolGrow_addChunk (ptrHandle, ptrStorage, size);
+                    ptrChunk = ptrHandle->ptrChunks;
+                }
+                else if ((ptrStorage != NULL) && (ptrHandle->release != NULL))
+                {
+                    /* Unusable chunk: handed back, not leaked. */
+                    ptrHandle->release (ptrHandle->ptrContext, ptrStorage, size);
+                }
+                else
+                {
+                    /* Just do nothing. */
+                }
+            }
+
+            /* Chunk found? */
+            if (ptrChunk != NULL)
+            {
+                /* Take slot from chunk bump pointer. */
+                *ptr2Slot = &ptrChunk->ptrSlots[(ptrChunk->bumpIndex * ptrHandle->slotSize)];
+                ptrChunk->bumpIndex++;
+
+                /* Mark slot as allocated (if bitmap). */
+                if (ptrChunk->ptrBitmap != NULL)
+                {
+                    ptrChunk->ptrBitmap[memPool_bitmapWord (ptrChunk->bumpIndex - 1U)] |=
+                        memPool_bitmapMask (ptrChunk->bumpIndex - 1U);
+                }
+
+                ptrHandle->ptrBumpChunk = ptrChunk;
+
+                /* Succeed! */
+                ret = MEM_POOL_OK;
+            }
+            else
+            {
+                /* Clear pointer. */
+                *ptr2Slot = NULL;
+
+                /* Error! No free slots! */
+                ret = MEM_POOL_ERROR_SPACE;
+            }
+        }
+
+        /* Succeed? */
+        if (ret == MEM_POOL_OK)
+        {
+        #if (defined memPool_zeroize && (memPool_zeroize == 1))
+            /* Zeroise the slot (as calloc). */
+            (void) memset (*ptr2Slot, 0x00, ptrHandle->slotSize);
+        #else
+            /* Clear next. */
+            *((uint8_t**) *ptr2Slot) = NULL;
+        #endif /* memPool_zeroize && (memPool_zeroize == 1) */
+        }
+    }
+
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPoolGrow_free (memPoolGrow_handle_t* ptrHandle, uint8_t* ptrSlot)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrHandle != NULL) && (ptrSlot != NULL));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrHandle != NULL) && (ptrSlot != NULL))
+    {
+        memPoolGrow_chunk_t* ptrChunk;
+        uintptr_t            offset;
+
+        /* Chunk slot lies in. */
+        ptrChunk = memPoolGrow_findChunk (ptrHandle, ptrSlot);
+        offset   = (ptrChunk != NULL) ? (((uintptr_t) ptrSlot) - ((uintptr_t) ptrChunk->ptrSlots)) : 0U;
+
+        /* Outside chunks, not on a slot boundary, never handed out or already freed? */
+        if ((ptrChunk == NULL)                                      ||
+            ((offset % ptrHandle->slotSize) != 0U)                  ||
+            ((offset / ptrHandle->slotSize) >= ptrChunk->bumpIndex) ||
+            !memPoolGrow_mark (ptrHandle, ptrChunk, ptrSlot, false))
+        {
+            /* Error! Slot was not allocated! */
+            ret = MEM_POOL_ERROR_SLOT_NOT_ALLOCATED;
+        }
+        else
+        {
+            /* Succeed! */
+            ret = MEM_POOL_OK;
+        }
+
+        /* Succeed? */
+        if (ret == MEM_POOL_OK)
+        {
+            /* Slot freed is the new head. */
+            *((uint8_t**) ptrSlot) = ptrHandle->ptrHead;
+            ptrHandle->ptrHead     = ptrSlot;
+        }
+    }
+
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPoolGrow_shrink (memPoolGrow_handle_t* ptrHandle, uint32_t* ptrReleased)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert (ptrHandle != NULL);
+
+    /* Check parameters (if defined). */
+    memPool_checkParam (ptrHandle != NULL)
+    {
+        memPoolGrow_chunk_t*  ptrChunk;
+        memPoolGrow_chunk_t** ptr2Chunk;
+        uint8_t**             ptr2Slot;
+        uint32_t              released;
+
+        /* Count free slots of every chunk. */
+        for (ptrChunk = ptrHandle->ptrChunks; ptrChunk != NULL; ptrChunk = ptrChunk->ptrNext)
+        {
+            ptrChunk->freeCount = 0U;
+        }
+
+        for (ptr2Slot = &ptrHandle->ptrHead; *ptr2Slot != NULL; ptr2Slot = (uint8_t**) *ptr2Slot)
+        {
+            ptrChunk = memPoolGrow_findChunk (ptrHandle, *ptr2Slot);
+
+            if (ptrChunk != NULL)
+            {
+                ptrChunk->freeCount++;
+            }
+        }
+
+        /* Chunk fully free if every slot handed out is back. */
+        for (ptrChunk = ptrHandle->ptrChunks; ptrChunk != NULL; ptrChunk = ptrChunk->ptrNext)
+        {
+            if (ptrChunk->freeCount == ptrChunk->bumpIndex)
+            {
+                ptrChunk->freeCount = MEM_POOL_GROW_RELEASE;
+            }
+        }
+
+        /* Unlink slots of released chunks from free list. */
+        ptr2Slot = &ptrHandle->ptrHead;
+
+        while (*ptr2Slot != NULL)
+        {
+            ptrChunk = memPoolGrow_findChunk (ptrHandle, *ptr2Slot);
+
+            if ((ptrChunk != NULL) && (ptrChunk->freeCount == MEM_POOL_GROW_RELEASE))
+            {
+                *ptr2Slot = *((uint8_t**) *ptr2Slot);
+            }
+            else
+            {
+                ptr2Slot = (uint8_t**) *ptr2Slot;
+            }
+        }
+
+        /* Unlink and hand back released chunks. */
+        ptr2Chunk = &ptrHandle->ptrChunks;
+        released  = 0U;
+
+        while (*ptr2Chunk != NULL)
+        {
+            ptrChunk = *ptr2Chunk;
+
+            if (ptrChunk->freeCount == MEM_POOL_GROW_RELEASE)
+            {
+                /* Unlink, no longer owned (slots of it are rejected from now on). */
+                *ptr2Chunk         = ptrChunk->ptrNext;
+                ptrChunk->ptrOwner = NULL;
+                released++;
+
+                if (ptrHandle->release != NULL)
+                {
+                    ptrHandle->release (ptrHandle->ptrContext, ((uint8_t*) ptrChunk), ptrChunk->size);
+                }
+            }
+            else
+            {
+                ptr2Chunk = &ptrChunk->ptrNext;
+            }
+        }
+
+        /* Restart bumping from newest chunk. */
+        ptrHandle->ptrBumpChunk = ptrHandle->ptrChunks;
+
+        /* Store number of chunks released. */
+        if (ptrReleased != NULL)
+        {
+            *ptrReleased = released;
+        }
+
+        /* Succeed! */
+        ret = MEM_POOL_OK;
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+/* ************************************************************************** *
+ *                       End of global function section                       *
+ * ************************************************************************** */
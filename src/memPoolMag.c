@@ -0,0 +1,394 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2021 Alessandro Morniroli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file   memPoolMag.c
+ * @author Alessandro Morniroli <alessandro.morniroli@gmail.com>
+ * @date   Sun Oct 18 2026
+ *
+ * @brief  Per-thread slot cache (magazine) implementation.
+ */
+
+/* ************************************************************************** *
+ *                         Start of includes section                          *
+ * ************************************************************************** */
+
+/* Standard C. */
+#include <stdatomic.h>
+#include <stddef.h>
+#include <string.h>
+/* POSIX. */
+#include <pthread.h>
+/* Module include. */
+#include "memPool_priv.h"
+#include "memPoolMag.h"
+
+/* ************************************************************************** *
+ *                          End of includes section                           *
+ * ************************************************************************** */
+
+#if (defined MEM_POOL_MAGAZINE_SIZE && (MEM_POOL_MAGAZINE_SIZE > 0))
+
+/* ************************************************************************** *
+ *                    Start of private definitions section                    *
+ * ************************************************************************** */
+
+/**
+ * Number of slots moved by a single refill/flush (half magazine).
+ */
+#define MEM_POOL_MAGAZINE_BATCH (((MEM_POOL_MAGAZINE_SIZE) + 1U) / 2U)
+
+/* ************************************************************************** *
+ *                     End of private definitions section                     *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                    Start of external variables section                     *
+ * ************************************************************************** */
+
+/* ************************************************************************** *
+ *                     End of external variables section                      *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                     Start of private variables section                     *
+ * ************************************************************************** */
+
+/**
+ * Thread specific key: its value is the list of magazines of the thread.
+ */
+static pthread_key_t  memPoolMag_key;
+static pthread_once_t memPoolMag_keyOnce = PTHREAD_ONCE_INIT;
+
+/* ************************************************************************** *
+ *                      End of private variables section                      *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                Start of private function prototypes section                *
+ * ************************************************************************** */
+
+static void
+memPoolMag_keyCreate (void);
+
+static void
+memPoolMag_threadExit (void* ptrValue);
+
+static bool
+memPoolMag_mark (const memPoolMt_handle_t* ptrPool, const uint8_t* ptrSlot, bool allocated);
+
+static memPool_error_t
+memPoolMag_flush (memPoolMag_t* ptrMag, uint32_t number);
+
+/* ************************************************************************** *
+ *                 End of private function prototypes section                 *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                     Start of private function section                      *
+ * ************************************************************************** */
+
+/**
+ * @brief Create thread specific key (once).
+ */
+static void
+memPoolMag_keyCreate (void)
+{
+    (void) pthread_key_create (&memPoolMag_key, memPoolMag_threadExit);
+}
+
+/**
+ * @brief Thread exit: hand cached slots of all thread magazines back.
+ */
+static void
+memPoolMag_threadExit (void* ptrValue)
+{
+    memPoolMag_t* ptrMag;
+
+    for (ptrMag = (memPoolMag_t*) ptrValue; ptrMag != NULL; ptrMag = ptrMag->ptrNext)
+    {
+        (void) memPoolMag_flush (ptrMag, ptrMag->count);
+    }
+}
+
+/**
+ * @brief Mark a slot of the pool as allocated (or cached, i.e. free) in its bitmap.
+ *
+ * @return true if slot was allocated before; false otherwise.
+ */
+static bool
+memPoolMag_mark (const memPoolMt_handle_t* ptrPool, const uint8_t* ptrSlot, bool allocated)
+{
+    uint32_t idx;
+    uint32_t word;
+
+    idx = (uint32_t) (((uintptr_t) (ptrSlot - ptrPool->ptrStorage)) / ptrPool->slotSize);
+
+    /* Bitmap word is shared with other threads: atomic update. */
+    if (allocated == true)
+    {
+        word = atomic_fetch_or_explicit (&ptrPool->ptrBitmap[memPool_bitmapWord (idx)], memPool_bitmapMask (idx),
+                                         memory_order_relaxed);
+    }
+    else
+    {
+        word = atomic_fetch_and_explicit (&ptrPool->ptrBitmap[memPool_bitmapWord (idx)], ~memPool_bitmapMask (idx),
+                                          memory_order_relaxed);
+    }
+
+    /* Return whether slot was allocated. */
+    return ((word & memPool_bitmapMask (idx)) != 0U);
+}
+
+/**
+ * @brief Hand the \p number oldest (bottom) cached slots back to the pool.
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise (slots
+ *         are removed from magazine anyway).
+ */
+static memPool_error_t
+memPoolMag_flush (memPoolMag_t* ptrMag, uint32_t number)
+{
+    memPool_error_t ret;
+    uint32_t        i;
+
+    /* Cached slots are free in the bitmap: allocated again, as the pool frees them. */
+    for (i = 0U; i < number; i++)
+    {
+        (void) memPoolMag_mark (ptrMag->ptrPool, ptrMag->slots[i], true);
+    }
+
+    /* Free oldest slots (keep most recently used ones, likely cache hot). */
+    ret = memPoolMt_freeBulk (ptrMag->ptrPool, &ptrMag->slots[0], number);
+
+    /* Move remaining slots to the bottom. */
+    ptrMag->count -= number;
+    (void) memmove (&ptrMag->slots[0], &ptrMag->slots[number], (ptrMag->count * sizeof (ptrMag->slots[0])));
+
+    /* Return the function result code. */
+    return ret;
+}
+
+/* ************************************************************************** *
+ *                      End of private function section                       *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                      Start of global function section                      *
+ * ************************************************************************** */
+
+memPool_error_t
+memPoolMag_init (memPoolMag_t* ptrMag, memPoolMt_handle_t* ptrPool)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrMag != NULL) && (ptrPool != NULL));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrMag != NULL) && (ptrPool != NULL))
+    {
+        /* Empty magazine. */
+        ptrMag->ptrPool = ptrPool;
+        ptrMag->count   = 0U;
+
+        /* Register magazine on the calling thread. */
+        (void) pthread_once (&memPoolMag_keyOnce, memPoolMag_keyCreate);
+
+        ptrMag->ptrNext = (memPoolMag_t*) pthread_getspecific (memPoolMag_key);
+
+        if (pthread_setspecific (memPoolMag_key, ptrMag) == 0)
+        {
+            /* Succeed! */
+            ret = MEM_POOL_OK;
+        }
+        else
+        {
+            /* Error! Thread exit hook not registered! */
+            ret = MEM_POOL_ERROR_PARAMETERS;
+        }
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPoolMag_deinit (memPoolMag_t* ptrMag)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert (ptrMag != NULL);
+
+    /* Check parameters (if defined). */
+    memPool_checkParam (ptrMag != NULL)
+    {
+        memPoolMag_t* ptrPrev;
+
+        /* Hand all cached slots back. */
+        ret = memPoolMag_flush (ptrMag, ptrMag->count);
+
+        /* Unregister magazine from the calling thread. */
+        ptrPrev = (memPoolMag_t*) pthread_getspecific (memPoolMag_key);
+
+        if (ptrPrev == ptrMag)
+        {
+            (void) pthread_setspecific (memPoolMag_key, ptrMag->ptrNext);
+        }
+        else
+        {
+            while (ptrPrev != NULL)
+            {
+                if (ptrPrev->ptrNext == ptrMag)
+                {
+                    ptrPrev->ptrNext = ptrMag->ptrNext;
+                }
+
+                ptrPrev = ptrPrev->ptrNext;
+            }
+        }
+
+        ptrMag->ptrNext = NULL;
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPoolMag_alloc (memPoolMag_t* ptrMag, uint8_t** ptr2Slot)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrMag != NULL) && (ptr2Slot != NULL));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrMag != NULL) && (ptr2Slot != NULL))
+    {
+        /* Empty magazine? */
+        if (ptrMag->count == 0U)
+        {
+            uint32_t i;
+
+            /* Refill (best effort, single CAS, slots cleared when popped). */
+            (void) memPoolMt_allocBulkRaw (ptrMag->ptrPool, &ptrMag->slots[0], MEM_POOL_MAGAZINE_BATCH,
+                                           &ptrMag->count);
+
+            /* Cached slots are free in the bitmap (until popped). */
+            for (i = 0U; i < ptrMag->count; i++)
+            {
+                (void) memPoolMag_mark (ptrMag->ptrPool, ptrMag->slots[i], false);
+            }
+        }
+
+        /* Slot cached? */
+        if (ptrMag->count != 0U)
+        {
+            /* Pop most recently freed slot, mark it as allocated. */
+            ptrMag->count--;
+            *ptr2Slot = ptrMag->slots[ptrMag->count];
+            (void) memPoolMag_mark (ptrMag->ptrPool, *ptr2Slot, true);
+
+        #if (defined memPool_zeroize && (memPool_zeroize == 1))
+            /* Zeroise the slot (as calloc, recycled slots too). */
+            (void) memset (*ptr2Slot, 0x00, ptrMag->ptrPool->slotSize);
+        #endif /* memPool_zeroize && (memPool_zeroize == 1) */
+
+            /* Succeed! */
+            ret = MEM_POOL_OK;
+        }
+        else
+        {
+            /* Clear pointer. */
+            *ptr2Slot = NULL;
+
+            /* Error! No free slots! */
+            ret = MEM_POOL_ERROR_SPACE;
+        }
+    }
+
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPoolMag_free (memPoolMag_t* ptrMag, uint8_t* ptrSlot)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrMag != NULL) && (ptrSlot != NULL));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrMag != NULL) && (ptrSlot != NULL))
+    {
+        uintptr_t offset;
+
+        /* Slot offset inside pool storage (wraps if below storage). */
+        offset = ((uintptr_t) ptrSlot) - ((uintptr_t) ptrMag->ptrPool->ptrStorage);
+
+        /* Outside pool, not on a slot boundary, or not allocated (marked as cached otherwise)? */
+        if ((offset >= (((uintptr_t) ptrMag->ptrPool->slotSize) * ptrMag->ptrPool->slotNumber)) ||
+            ((offset % ptrMag->ptrPool->slotSize) != 0U)                                        ||
+            (memPoolMag_mark (ptrMag->ptrPool, ptrSlot, false) == false))
+        {
+            /* Error! Slot was not allocated! */
+            ret = MEM_POOL_ERROR_SLOT_NOT_ALLOCATED;
+        }
+        else
+        {
+            /* Full magazine? Flush half of it. */
+            ret = (ptrMag->count == MEM_POOL_MAGAZINE_SIZE) ? memPoolMag_flush (ptrMag, MEM_POOL_MAGAZINE_BATCH) :
+                                                              MEM_POOL_OK;
+
+            /* Push slot. */
+            ptrMag->slots[ptrMag->count] = ptrSlot;
+            ptrMag->count++;
+        }
+    }
+
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+/* ************************************************************************** *
+ *                       End of global function section                       *
+ * ************************************************************************** */
+
+#endif /* MEM_POOL_MAGAZINE_SIZE && (MEM_POOL_MAGAZINE_SIZE > 0) */
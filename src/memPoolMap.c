@@ -0,0 +1,454 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2021 Alessandro Morniroli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file   memPoolMap.c
+ * @author Alessandro Morniroli <alessandro.morniroli@gmail.com>
+ * @date   Sun Oct 18 2026
+ *
+ * @brief  mmap backed pool storage (Linux) implementation.
+ */
+
+/* ************************************************************************** *
+ *                         Start of includes section                          *
+ * ************************************************************************** */
+
+/* Feature test (MAP_HUGETLB, MADV_HUGEPAGE, syscall, getcpu). */
+#define _GNU_SOURCE
+
+/* Standard C. */
+#include <errno.h>
+#include <stddef.h>
+#include <string.h>
+/* Linux. */
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+/* Module include. */
+#include "memPool_priv.h"
+#include "memPoolMap.h"
+
+/* ************************************************************************** *
+ *                          End of includes section                           *
+ * ************************************************************************** */
+
+#if (defined MEM_POOL_MAP_NODES && (MEM_POOL_MAP_NODES > 0))
+
+
+/* ************************************************************************** *
+ *                    Start of private definitions section                    *
+ * ************************************************************************** */
+
+/**
+ * Huge page size (bytes) mappings are rounded to with \ref MEM_POOL_MAP_FLAG_HUGETLB.
+ */
+#define MEM_POOL_MAP_HUGE_PAGE_SIZE (2UL * 1024UL * 1024UL)
+
+/**
+ * mbind policy (linux/mempolicy.h, not always installed).
+ */
+#ifndef MPOL_BIND
+    #define MPOL_BIND 2
+#endif /* MPOL_BIND */
+
+/**
+ * Prefault advice (Linux 5.14, pages touched one by one on older kernels).
+ */
+#ifndef MADV_POPULATE_WRITE
+    #define MADV_POPULATE_WRITE 23
+#endif /* MADV_POPULATE_WRITE */
+
+/* ************************************************************************** *
+ *                     End of private definitions section                     *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                    Start of external variables section                     *
+ * ************************************************************************** */
+
+/* ************************************************************************** *
+ *                     End of external variables section                      *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                     Start of private variables section                     *
+ * ************************************************************************** */
+
+/* ************************************************************************** *
+ *                      End of private variables section                      *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                Start of private function prototypes section                *
+ * ************************************************************************** */
+
+static int32_t
+memPoolMap_currentNode (void);
+
+static void
+memPoolMap_populate (uint8_t* ptrStorage, size_t mapped, size_t page);
+
+/* ************************************************************************** *
+ *                 End of private function prototypes section                 *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                     Start of private function section                      *
+ * ************************************************************************** */
+
+/**
+ * @brief Get NUMA node the calling thread runs on (0 if unknown).
+ */
+static int32_t
+memPoolMap_currentNode (void)
+{
+    unsigned int cpu;
+    unsigned int node;
+
+    /* glibc getcpu goes through the vDSO on most architectures (no syscall). */
+    if (getcpu (&cpu, &node) != 0)
+    {
+        node = 0U;
+    }
+
+    /* Return the node. */
+    return (int32_t) node;
+}
+
+/**
+ * @brief Populate (prefault) mapping, with its final policy (THP, node) set.
+ */
+static void
+memPoolMap_populate (uint8_t* ptrStorage, size_t mapped, size_t page)
+{
+    /* Kernel has no populate advice? Write a byte of each page. */
+    if (madvise (ptrStorage, mapped, MADV_POPULATE_WRITE) != 0)
+    {
+        volatile uint8_t* ptrPage;
+
+        for (ptrPage = ptrStorage; ptrPage < &ptrStorage[mapped]; ptrPage += page)
+        {
+            *ptrPage = 0U;
+        }
+    }
+}
+
+/* ************************************************************************** *
+ *                      End of private function section                       *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                      Start of global function section                      *
+ * ************************************************************************** */
+
+memPool_error_t
+memPoolMap_reserve (uint8_t** ptr2Storage, size_t size, uint32_t flags, int32_t node, size_t* ptrMapped)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptr2Storage != NULL) && (ptrMapped != NULL) && (size != 0U) &&
+                    (node >= MEM_POOL_MAP_NO_NODE) && (node < 64));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptr2Storage != NULL) && (ptrMapped != NULL) && (size != 0U) &&
+                        (node >= MEM_POOL_MAP_NO_NODE) && (node < 64))
+    {
+        void*  ptr;
+        size_t page;
+        int    mapFlags;
+
+        /* Lazily populated (no swap reservation either): populated once placed, if requested. */
+        mapFlags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE;
+        ptr      = MAP_FAILED;
+
+        /* Explicit huge pages first (if requested). */
+        if ((flags & MEM_POOL_MAP_FLAG_HUGETLB) != 0U)
+        {
+            page       = MEM_POOL_MAP_HUGE_PAGE_SIZE;
+            *ptrMapped = (size + (MEM_POOL_MAP_HUGE_PAGE_SIZE - 1U)) & ~(MEM_POOL_MAP_HUGE_PAGE_SIZE - 1U);
+
+            /* Huge pages reserved at mmap time (MAP_NORESERVE would defer failure to a SIGBUS on touch). */
+            ptr = mmap (NULL, *ptrMapped, (PROT_READ | PROT_WRITE), ((mapFlags & ~MAP_NORESERVE) | MAP_HUGETLB), -1, 0);
+        }
+
+        /* Regular pages (also if no huge pages are reserved). */
+        if (ptr == MAP_FAILED)
+        {
+            page       = (size_t) sysconf (_SC_PAGESIZE);
+            *ptrMapped = (size + (page - 1U)) & ~(page - 1U);
+            ptr        = mmap (NULL, *ptrMapped, (PROT_READ | PROT_WRITE), mapFlags, -1, 0);
+
+            /* Transparent huge pages (explicit ones fall back to them). */
+            if ((ptr != MAP_FAILED) && ((flags & (MEM_POOL_MAP_FLAG_HUGETLB | MEM_POOL_MAP_FLAG_THP)) != 0U))
+            {
+                (void) madvise (ptr, *ptrMapped, MADV_HUGEPAGE);
+            }
+        }
+
+        if (ptr == MAP_FAILED)
+        {
+            /* Error! No memory! */
+            *ptr2Storage = NULL;
+            *ptrMapped   = 0U;
+            ret          = MEM_POOL_ERROR_SPACE;
+        }
+        else
+        {
+            /* Succeed (unless binding fails)! */
+            *ptr2Storage = (uint8_t*) ptr;
+            ret          = MEM_POOL_OK;
+
+            /* Bind to NUMA node (no page touched yet)? Kernel with no NUMA: storage left unbound. */
+            if (node != MEM_POOL_MAP_NO_NODE)
+            {
+                unsigned long mask;
+
+                mask = 1UL << ((uint32_t) node);
+
+                if ((syscall (SYS_mbind, ptr, *ptrMapped, MPOL_BIND, &mask, (sizeof (mask) * 8U), 0U) != 0) &&
+                    (errno != ENOSYS))
+                {
+                    /* Error! Node not available! */
+                    (void) munmap (ptr, *ptrMapped);
+                    *ptr2Storage = NULL;
+                    *ptrMapped   = 0U;
+                    ret          = MEM_POOL_ERROR_PARAMETERS;
+                }
+            }
+
+            /* Prefault (if requested), pages placed as advised / bound above. */
+            if ((ret == MEM_POOL_OK) && ((flags & MEM_POOL_MAP_FLAG_POPULATE) != 0U))
+            {
+                memPoolMap_populate (*ptr2Storage, *ptrMapped, page);
+            }
+        }
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPoolMap_release (uint8_t* ptrStorage, size_t mapped)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrStorage != NULL) && (mapped != 0U));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrStorage != NULL) && (mapped != 0U))
+    {
+        /* Unmap. */
+        ret = (munmap (ptrStorage, mapped) == 0) ? MEM_POOL_OK : MEM_POOL_ERROR_PARAMETERS;
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPoolMap_nodeSetInit (memPoolMap_nodeSet_t* ptrSet,
+                        uint32_t              slotSize,
+                        uint32_t              slotNumber,
+                        uint32_t              nodeNumber,
+                        uint32_t              flags)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrSet     != NULL) &&
+                    (slotNumber != 0U)   &&
+                    (nodeNumber != 0U)   &&
+                    (nodeNumber <= MEM_POOL_MAP_NODES));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrSet     != NULL) &&
+                        (slotNumber != 0U)   &&
+                        (nodeNumber != 0U)   &&
+                        (nodeNumber <= MEM_POOL_MAP_NODES))
+    {
+        size_t   storageSize;
+        uint32_t n;
+
+        /* Slots, then allocation bitmap, in the same mapping. */
+        storageSize = ((size_t) slotSize) * slotNumber;
+
+        (void) memset (ptrSet, 0x00, sizeof (*ptrSet));
+
+        ret = MEM_POOL_OK;
+
+        for (n = 0U; (n < nodeNumber) && (ret == MEM_POOL_OK); n++)
+        {
+            ret = memPoolMap_reserve (&ptrSet->ptrStorage[n],
+                                      (storageSize + (MEM_POOL_BITMAP_WORDS (slotNumber) * sizeof (uint32_t))),
+                                      flags, (int32_t) n, &ptrSet->mapped[n]);
+
+            if (ret == MEM_POOL_OK)
+            {
+                ptrSet->nodeNumber = n + 1U;
+
+                ret = memPoolMt_init (&ptrSet->pools[n], ptrSet->ptrStorage[n],
+                                      (_Atomic uint32_t*) &ptrSet->ptrStorage[n][storageSize], slotSize, slotNumber);
+            }
+        }
+
+        /* Failed? Release what was reserved. */
+        if (ret != MEM_POOL_OK)
+        {
+            (void) memPoolMap_nodeSetDeinit (ptrSet);
+        }
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPoolMap_nodeSetDeinit (memPoolMap_nodeSet_t* ptrSet)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert (ptrSet != NULL);
+
+    /* Check parameters (if defined). */
+    memPool_checkParam (ptrSet != NULL)
+    {
+        uint32_t n;
+
+        /* Clear error code. */
+        ret = MEM_POOL_OK;
+
+        for (n = 0U; n < ptrSet->nodeNumber; n++)
+        {
+            if (memPoolMap_release (ptrSet->ptrStorage[n], ptrSet->mapped[n]) != MEM_POOL_OK)
+            {
+                ret = MEM_POOL_ERROR_PARAMETERS;
+            }
+        }
+
+        ptrSet->nodeNumber = 0U;
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPoolMap_nodeSetAlloc (memPoolMap_nodeSet_t* ptrSet, uint8_t** ptr2Slot)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrSet != NULL) && (ptr2Slot != NULL));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrSet != NULL) && (ptr2Slot != NULL))
+    {
+        uint32_t local;
+        uint32_t i;
+
+        /* Local node first, then the others. */
+        local = ((uint32_t) memPoolMap_currentNode ()) % ptrSet->nodeNumber;
+        i     = 0U;
+
+        do
+        {
+            ret = memPoolMt_tryAlloc (&ptrSet->pools[(local + i) % ptrSet->nodeNumber], ptr2Slot);
+            i++;
+        } while ((ret == MEM_POOL_ERROR_SPACE) && (i < ptrSet->nodeNumber));
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPoolMap_nodeSetFree (memPoolMap_nodeSet_t* ptrSet, uint8_t* ptrSlot)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrSet != NULL) && (ptrSlot != NULL));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrSet != NULL) && (ptrSlot != NULL))
+    {
+        uint32_t n;
+
+        /* Find pool from address range (nodes are few). */
+        n = 0U;
+
+        while ((n < ptrSet->nodeNumber) &&
+               ((((uintptr_t) ptrSlot) - ((uintptr_t) ptrSet->ptrStorage[n])) >=
+                (((uintptr_t) ptrSet->pools[n].slotSize) * ptrSet->pools[n].slotNumber)))
+        {
+            n++;
+        }
+
+        /* Inside a pool? */
+        if (n < ptrSet->nodeNumber)
+        {
+            ret = memPoolMt_free (&ptrSet->pools[n], ptrSlot);
+        }
+        else
+        {
+            /* Error! Slot is outside every pool! */
+            ret = MEM_POOL_ERROR_SLOT_NOT_ALLOCATED;
+        }
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+/* ************************************************************************** *
+ *                       End of global function section                       *
+ * ************************************************************************** */
+
+#endif /* defined MEM_POOL_MAP_NODES && (MEM_POOL_MAP_NODES > 0) */
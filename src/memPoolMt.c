@@ -0,0 +1,812 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2021 Alessandro Morniroli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file   memPoolMt.c
+ * @author Alessandro Morniroli <alessandro.morniroli@gmail.com>
+ * @date   Sun Oct 18 2026
+ *
+ * @brief  Lock-free (thread-safe) static memory pool utility implementation.
+ */
+
+/* ************************************************************************** *
+ *                         Start of includes section                          *
+ * ************************************************************************** */
+
+/* Standard C. */
+#include <stddef.h>
+#include <string.h>
+/* Module include. */
+#include "memPool_priv.h"
+#include "memPoolMt.h"
+
+/* ************************************************************************** *
+ *                          End of includes section                           *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                    Start of private definitions section                    *
+ * ************************************************************************** */
+
+/**
+ * Tagged head helpers (index is stored plus one, zero means empty list).
+ */
+#define memPoolMt_headIndex(head)    ((uint32_t) ((head) & 0xFFFFFFFFU))
+#define memPoolMt_headTag(head)      ((uint32_t) ((head) >> 32U))
+#define memPoolMt_headMake(tag, idx) ((((uint64_t) (tag)) << 32U) | ((uint64_t) (idx)))
+
+/**
+ * Free list link (index of next slot plus one) stored in the slot itself.
+ */
+#define memPoolMt_link(pH, idx) ((_Atomic uint32_t*) &(pH)->ptrStorage[(((size_t) (idx)) * (pH)->slotSize)])
+
+/**
+ * Index of a slot handed out by the pool.
+ */
+#define memPoolMt_index(pH, pS) ((uint32_t) (((uintptr_t) ((pS) - (pH)->ptrStorage)) / (pH)->slotSize))
+
+/**
+ * Statistics update macro (calling thread shard, nothing if disabled).
+ */
+#if (defined MEM_POOL_STATS && (MEM_POOL_STATS == 1))
+    #define memPoolMt_statsAdd(pH, field, n) \
+        ((void) atomic_fetch_add_explicit (&(pH)->stats[memPoolMt_shard ()].field, (n), memory_order_relaxed))
+#else
+    #define memPoolMt_statsAdd(pH, field, n)
+#endif /* MEM_POOL_STATS && (MEM_POOL_STATS == 1) */
+
+/**
+ * Slots in use update macros (peak tracked on the way up, nothing if disabled).
+ */
+#if (defined MEM_POOL_STATS && (MEM_POOL_STATS == 1))
+    #define memPoolMt_useAdd(pH) memPoolMt_statsPeak ((pH))
+    #define memPoolMt_useSub(pH) \
+        ((void) atomic_fetch_sub_explicit (&(pH)->use.inUse, 1U, memory_order_relaxed))
+#else
+    #define memPoolMt_useAdd(pH)
+    #define memPoolMt_useSub(pH)
+#endif /* MEM_POOL_STATS && (MEM_POOL_STATS == 1) */
+
+/* ************************************************************************** *
+ *                     End of private definitions section                     *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                    Start of external variables section                     *
+ * ************************************************************************** */
+
+/* ************************************************************************** *
+ *                     End of external variables section                      *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                     Start of private variables section                     *
+ * ************************************************************************** */
+
+#if (defined MEM_POOL_STATS && (MEM_POOL_STATS == 1))
+/**
+ * Statistics shard of the calling thread (plus one, zero if not assigned yet)
+ * and next shard to assign.
+ */
+static _Thread_local uint32_t memPoolMt_threadShard;
+static _Atomic uint32_t       memPoolMt_nextShard;
+#endif /* MEM_POOL_STATS && (MEM_POOL_STATS == 1) */
+
+/* ************************************************************************** *
+ *                      End of private variables section                      *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                Start of private function prototypes section                *
+ * ************************************************************************** */
+
+#if (defined MEM_POOL_STATS && (MEM_POOL_STATS == 1))
+static uint32_t
+memPoolMt_shard (void);
+#endif /* MEM_POOL_STATS && (MEM_POOL_STATS == 1) */
+
+static memPool_error_t
+memPoolMt_slotIndex (const memPoolMt_handle_t* ptrHandle, const uint8_t* ptrSlot, uint32_t* ptrIdx);
+
+static uint32_t
+memPoolMt_popChain (memPoolMt_handle_t* ptrHandle, uint8_t** ptrArray, uint32_t count);
+
+static uint32_t
+memPoolMt_bump (memPoolMt_handle_t* ptrHandle, uint8_t** ptrArray, uint32_t count);
+
+static void
+memPoolMt_pushChain (memPoolMt_handle_t* ptrHandle, uint32_t firstIdx, uint32_t lastIdx);
+
+static void
+memPoolMt_allocated (memPoolMt_handle_t* ptrHandle, uint8_t* ptrSlot, bool clear);
+
+#if (defined MEM_POOL_STATS && (MEM_POOL_STATS == 1))
+static void
+memPoolMt_statsPeak (memPoolMt_handle_t* ptrHandle);
+#endif /* MEM_POOL_STATS && (MEM_POOL_STATS == 1) */
+
+static memPool_error_t
+memPoolMt_take (memPoolMt_handle_t* ptrHandle, uint8_t** ptrArray, uint32_t count, uint32_t* ptrGot, bool clear);
+
+static memPool_error_t
+memPoolMt_get (memPoolMt_handle_t* ptrHandle, uint8_t** ptr2Slot);
+
+static memPool_error_t
+memPoolMt_release (memPoolMt_handle_t* ptrHandle, const uint8_t* ptrSlot, uint32_t* ptrIdx);
+
+/* ************************************************************************** *
+ *                 End of private function prototypes section                 *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                     Start of private function section                      *
+ * ************************************************************************** */
+
+#if (defined MEM_POOL_STATS && (MEM_POOL_STATS == 1))
+/**
+ * @brief Get statistics shard of the calling thread (assigned round robin).
+ */
+static uint32_t
+memPoolMt_shard (void)
+{
+    /* First use from this thread? */
+    if (memPoolMt_threadShard == 0U)
+    {
+        memPoolMt_threadShard = (atomic_fetch_add_explicit (&memPoolMt_nextShard, 1U, memory_order_relaxed) %
+                                 MEM_POOL_STATS_SHARDS) + 1U;
+    }
+
+    /* Return the shard index. */
+    return memPoolMt_threadShard - 1U;
+}
+#endif /* MEM_POOL_STATS && (MEM_POOL_STATS == 1) */
+
+/**
+ * @brief Get index of a slot handed out by the pool.
+ *
+ * @return MEM_POOL_OK if slot belongs to the pool, is on a slot boundary and
+ *         was handed out; MEM_POOL_ERROR_SLOT_NOT_ALLOCATED otherwise.
+ */
+static memPool_error_t
+memPoolMt_slotIndex (const memPoolMt_handle_t* ptrHandle, const uint8_t* ptrSlot, uint32_t* ptrIdx)
+{
+    memPool_error_t ret;
+    uintptr_t       offset;
+
+    /* Slot offset inside storage (wraps if below storage). */
+    offset  = ((uintptr_t) ptrSlot) - ((uintptr_t) ptrHandle->ptrStorage);
+    *ptrIdx = (uint32_t) (offset / ptrHandle->slotSize);
+
+    /* Outside pool, not on a slot boundary or never handed out? */
+    if ((offset >= (((uintptr_t) ptrHandle->slotSize) * ptrHandle->slotNumber)) ||
+        ((offset % ptrHandle->slotSize) != 0U)                                  ||
+        (*ptrIdx >= atomic_load_explicit (&ptrHandle->bumpIndex, memory_order_relaxed)))
+    {
+        /* Error! Slot was not allocated! */
+        ret = MEM_POOL_ERROR_SLOT_NOT_ALLOCATED;
+    }
+    else
+    {
+        /* Succeed! */
+        ret = MEM_POOL_OK;
+    }
+
+    /* Return the function result code. */
+    return ret;
+}
+
+/**
+ * @brief Unlink up to \p count slots from the free list (single CAS).
+ *
+ * @return Number of slots unlinked (stored into \p ptrArray).
+ */
+static uint32_t
+memPoolMt_popChain (memPoolMt_handle_t* ptrHandle, uint8_t** ptrArray, uint32_t count)
+{
+    uint64_t head;
+    uint64_t next;
+    uint32_t top;
+    uint32_t i;
+    bool     done;
+
+    head = atomic_load_explicit (&ptrHandle->head, memory_order_acquire);
+    done = false;
+    i    = 0U;
+
+    while ((done == false) && (memPoolMt_headIndex (head) != 0U) && (count != 0U))
+    {
+        /*
+         * Walk the chain. Links may be stale if slots were popped meanwhile
+         * (tag makes the swap fail then): just never leave the storage.
+         */
+        top = memPoolMt_headIndex (head);
+        i   = 0U;
+
+        while ((i < count) && (top != 0U) && (top <= ptrHandle->slotNumber))
+        {
+            ptrArray[i] = &ptrHandle->ptrStorage[(((size_t) (top - 1U)) * ptrHandle->slotSize)];
+            top         = atomic_load_explicit (memPoolMt_link (ptrHandle, (top - 1U)), memory_order_relaxed);
+            i++;
+        }
+
+        next = memPoolMt_headMake (memPoolMt_headTag (head) + 1U, top);
+
+        /* Swap head (on failure head is reloaded). */
+        done = atomic_compare_exchange_weak_explicit (&ptrHandle->head, &head, next,
+                                                      memory_order_acquire, memory_order_acquire);
+    }
+
+    /* Return the number of slots unlinked. */
+    return (done == true) ? i : 0U;
+}
+
+/**
+ * @brief Take up to \p count slots never handed out (bump pointer).
+ *
+ * @return Number of slots taken (stored into \p ptrArray).
+ */
+static uint32_t
+memPoolMt_bump (memPoolMt_handle_t* ptrHandle, uint8_t** ptrArray, uint32_t count)
+{
+    uint32_t idx;
+    uint32_t number;
+    uint32_t i;
+    bool     done;
+
+    /* Never beyond slot number. */
+    idx    = atomic_load_explicit (&ptrHandle->bumpIndex, memory_order_relaxed);
+    done   = false;
+    number = 0U;
+
+    while ((done == false) && (idx < ptrHandle->slotNumber))
+    {
+        number = ((ptrHandle->slotNumber - idx) < count) ? (ptrHandle->slotNumber - idx) : count;
+        done   = atomic_compare_exchange_weak_explicit (&ptrHandle->bumpIndex, &idx, (idx + number),
+                                                        memory_order_relaxed, memory_order_relaxed);
+    }
+
+    number = (done == true) ? number : 0U;
+
+    for (i = 0U; i < number; i++)
+    {
+        ptrArray[i] = &ptrHandle->ptrStorage[(((size_t) (idx + i)) * ptrHandle->slotSize)];
+    }
+
+    /* Return the number of slots taken. */
+    return number;
+}
+
+/**
+ * @brief Splice an already linked chain (first to last) on the free list.
+ */
+static void
+memPoolMt_pushChain (memPoolMt_handle_t* ptrHandle, uint32_t firstIdx, uint32_t lastIdx)
+{
+    uint64_t head;
+    uint64_t next;
+    bool     done;
+
+    head = atomic_load_explicit (&ptrHandle->head, memory_order_relaxed);
+
+    do
+    {
+        /* Last slot links to current head. */
+        atomic_store_explicit (memPoolMt_link (ptrHandle, lastIdx), memPoolMt_headIndex (head),
+                               memory_order_relaxed);
+
+        next = memPoolMt_headMake (memPoolMt_headTag (head) + 1U, firstIdx + 1U);
+
+        /* Swap head (on failure head is reloaded). */
+        done = atomic_compare_exchange_weak_explicit (&ptrHandle->head, &head, next,
+                                                      memory_order_release, memory_order_relaxed);
+    } while (done == false);
+}
+
+/**
+ * @brief Finalize allocation of a slot (mark as allocated & zeroize, if \p clear).
+ */
+static void
+memPoolMt_allocated (memPoolMt_handle_t* ptrHandle, uint8_t* ptrSlot, bool clear)
+{
+    uint32_t idx;
+
+    /* Update statistics (if defined). */
+    memPoolMt_statsAdd (ptrHandle, allocs, 1U);
+    memPoolMt_useAdd (ptrHandle);
+
+    /* Mark slot as allocated. */
+    idx = memPoolMt_index (ptrHandle, ptrSlot);
+    (void) atomic_fetch_or_explicit (&ptrHandle->ptrBitmap[memPool_bitmapWord (idx)],
+                                     memPool_bitmapMask (idx), memory_order_relaxed);
+
+    /* Slot handed out as is (cleared by caller)? */
+    if (clear == true)
+    {
+    #if (defined memPool_zeroize && (memPool_zeroize == 1))
+        /* Zeroise the slot (as calloc). */
+        (void) memset (ptrSlot, 0x00, ptrHandle->slotSize);
+    #else
+        /* Clear next. */
+        atomic_store_explicit ((_Atomic uint32_t*) ptrSlot, 0U, memory_order_relaxed);
+    #endif /* memPool_zeroize && (memPool_zeroize == 1) */
+    }
+}
+
+#if (defined MEM_POOL_STATS && (MEM_POOL_STATS == 1))
+/**
+ * @brief Count a slot in use, raising the peak if exceeded.
+ *
+ * Slots taken back by a failed all-or-nothing bulk allocation are never
+ * counted (unlike the bump pointer, which stays where it went).
+ */
+static void
+memPoolMt_statsPeak (memPoolMt_handle_t* ptrHandle)
+{
+    uint32_t inUse;
+    uint32_t peak;
+    bool     done;
+
+    inUse = atomic_fetch_add_explicit (&ptrHandle->use.inUse, 1U, memory_order_relaxed) + 1U;
+    peak  = atomic_load_explicit (&ptrHandle->use.highWater, memory_order_relaxed);
+
+    do
+    {
+        /* Raise peak if exceeded (on failure peak is reloaded). */
+        done = (inUse <= peak) ||
+               atomic_compare_exchange_weak_explicit (&ptrHandle->use.highWater, &peak, inUse,
+                                                      memory_order_relaxed, memory_order_relaxed);
+    } while (done == false);
+}
+#endif /* MEM_POOL_STATS && (MEM_POOL_STATS == 1) */
+
+/**
+ * @brief Release an allocated slot (check & mark as freed, not linked yet).
+ *
+ * @return MEM_POOL_OK if slot was allocated; anything else otherwise.
+ */
+static memPool_error_t
+memPoolMt_release (memPoolMt_handle_t* ptrHandle, const uint8_t* ptrSlot, uint32_t* ptrIdx)
+{
+    memPool_error_t ret;
+
+    /* Check that slot belongs to pool. */
+    ret = memPoolMt_slotIndex (ptrHandle, ptrSlot, ptrIdx);
+
+    /* Slot in pool? */
+    if (ret == MEM_POOL_OK)
+    {
+        uint32_t word;
+
+        /* Mark slot as freed (atomically, so that only one free wins). */
+        word = atomic_fetch_and_explicit (&ptrHandle->ptrBitmap[memPool_bitmapWord (*ptrIdx)],
+                                          ~memPool_bitmapMask (*ptrIdx), memory_order_relaxed);
+
+        /* Was not allocated? */
+        if ((word & memPool_bitmapMask (*ptrIdx)) == 0U)
+        {
+            /* Error! Slot was not allocated! */
+            ret = MEM_POOL_ERROR_SLOT_NOT_ALLOCATED;
+        }
+    }
+
+    /* Update statistics (if defined). */
+    if (ret == MEM_POOL_OK)
+    {
+        memPoolMt_statsAdd (ptrHandle, frees, 1U);
+        memPoolMt_useSub (ptrHandle);
+    }
+    else
+    {
+        memPoolMt_statsAdd (ptrHandle, freeFailures, 1U);
+    }
+
+    /* Return the function result code. */
+    return ret;
+}
+
+/**
+ * @brief Take up to \p count slots (as \ref memPoolMt_allocBulk, cleared if \p clear).
+ *
+ * @return See \ref memPool_allocBulk.
+ */
+static memPool_error_t
+memPoolMt_take (memPoolMt_handle_t* ptrHandle, uint8_t** ptrArray, uint32_t count, uint32_t* ptrGot, bool clear)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrHandle != NULL) && (ptrArray != NULL));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrHandle != NULL) && (ptrArray != NULL))
+    {
+        uint32_t i;
+        uint32_t number;
+
+        /* One CAS for the free list chain, one for the bump pointer. */
+        number  = memPoolMt_popChain (ptrHandle, ptrArray, count);
+        number += memPoolMt_bump (ptrHandle, &ptrArray[number], (count - number));
+
+        /* Not enough slots for an all-or-nothing request? */
+        if ((number != count) && (ptrGot == NULL))
+        {
+            /* Link slots taken and give them back at once. */
+            for (i = 1U; i < number; i++)
+            {
+                atomic_store_explicit ((_Atomic uint32_t*) ptrArray[i - 1U],
+                                       (memPoolMt_index (ptrHandle, ptrArray[i]) + 1U), memory_order_relaxed);
+            }
+
+            if (number != 0U)
+            {
+                memPoolMt_pushChain (ptrHandle,
+                                     memPoolMt_index (ptrHandle, ptrArray[0]),
+                                     memPoolMt_index (ptrHandle, ptrArray[number - 1U]));
+            }
+
+            /* Nothing allocated. */
+            number = 0U;
+        }
+
+        /* Finalize allocation. */
+        for (i = 0U; i < number; i++)
+        {
+            memPoolMt_allocated (ptrHandle, ptrArray[i], clear);
+        }
+
+        /* Clear unused entries. */
+        (void) memset (&ptrArray[number], 0x00, ((count - number) * sizeof (*ptrArray)));
+
+        /* Store number of slots allocated. */
+        if (ptrGot != NULL)
+        {
+            *ptrGot = number;
+        }
+
+        /* Succeed if all slots (best effort: any slot) were allocated. */
+        ret = ((number == count) || ((number != 0U) && (ptrGot != NULL))) ? MEM_POOL_OK : MEM_POOL_ERROR_SPACE;
+
+        /* Update statistics (if defined). */
+        if (ret != MEM_POOL_OK)
+        {
+            memPoolMt_statsAdd (ptrHandle, allocFailures, 1U);
+        }
+    }
+
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+/**
+ * @brief Take a slot (as \ref memPoolMt_alloc, not asserted).
+ *
+ * @return MEM_POOL_OK if no error occurred; anything else otherwise.
+ */
+static memPool_error_t
+memPoolMt_get (memPoolMt_handle_t* ptrHandle, uint8_t** ptr2Slot)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrHandle != NULL) && (ptr2Slot != NULL));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrHandle != NULL) && (ptr2Slot != NULL))
+    {
+        /* Pop free list head, or take slot from bump pointer. */
+        if ((memPoolMt_popChain (ptrHandle, ptr2Slot, 1U) == 1U) ||
+            (memPoolMt_bump (ptrHandle, ptr2Slot, 1U) == 1U))
+        {
+            /* Finalize allocation. */
+            memPoolMt_allocated (ptrHandle, *ptr2Slot, true);
+
+            /* Succeed! */
+            ret = MEM_POOL_OK;
+        }
+        else
+        {
+            /* Clear pointer. */
+            *ptr2Slot = NULL;
+
+            /* Update statistics (if defined). */
+            memPoolMt_statsAdd (ptrHandle, allocFailures, 1U);
+
+            /* Error! No free slots! */
+            ret = MEM_POOL_ERROR_SPACE;
+        }
+    }
+
+    /* Return the function result code (asserted by caller). */
+    return ret;
+}
+
+/* ************************************************************************** *
+ *                      End of private function section                       *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                      Start of global function section                      *
+ * ************************************************************************** */
+
+memPool_error_t
+memPoolMt_init (memPoolMt_handle_t* ptrHandle,
+                uint8_t*            ptrStorage,
+                _Atomic uint32_t*   ptrBitmap,
+                uint32_t            slotSize,
+                uint32_t            slotNumber)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrHandle  != NULL)                                   &&
+                    (ptrStorage != NULL)                                   &&
+                    (ptrBitmap  != NULL)                                   &&
+                    ((((uintptr_t) ptrStorage) % sizeof (uint32_t)) == 0U) &&
+                    (slotSize   != 0U)                                     &&
+                    ((slotSize % sizeof (uint32_t)) == 0U)                 &&
+                    (slotNumber != 0U)                                     &&
+                    (slotNumber <  UINT32_MAX));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrHandle  != NULL)                                   &&
+                        (ptrStorage != NULL)                                   &&
+                        (ptrBitmap  != NULL)                                   &&
+                        ((((uintptr_t) ptrStorage) % sizeof (uint32_t)) == 0U) &&
+                        (slotSize   != 0U)                                     &&
+                        ((slotSize % sizeof (uint32_t)) == 0U)                 &&
+                        (slotNumber != 0U)                                     &&
+                        (slotNumber <  UINT32_MAX))
+    {
+        uint32_t i;
+
+        /* No slots allocated. */
+        for (i = 0U; i < MEM_POOL_BITMAP_WORDS (slotNumber); i++)
+        {
+            atomic_init (&ptrBitmap[i], 0U);
+        }
+
+        /* Copy pool info (storage is handed out by bump pointer first). */
+        atomic_init (&ptrHandle->head,      memPoolMt_headMake (0U, 0U));
+        atomic_init (&ptrHandle->bumpIndex, 0U);
+        ptrHandle->ptrStorage = ptrStorage;
+        ptrHandle->ptrBitmap  = ptrBitmap;
+        ptrHandle->slotSize   = slotSize;
+        ptrHandle->slotNumber = slotNumber;
+
+    #if (defined MEM_POOL_STATS && (MEM_POOL_STATS == 1))
+        /* Clear statistics. */
+        for (i = 0U; i < MEM_POOL_STATS_SHARDS; i++)
+        {
+            atomic_init (&ptrHandle->stats[i].allocs,        0U);
+            atomic_init (&ptrHandle->stats[i].frees,         0U);
+            atomic_init (&ptrHandle->stats[i].allocFailures, 0U);
+            atomic_init (&ptrHandle->stats[i].freeFailures,  0U);
+        }
+
+        atomic_init (&ptrHandle->use.inUse,     0U);
+        atomic_init (&ptrHandle->use.highWater, 0U);
+    #endif /* MEM_POOL_STATS && (MEM_POOL_STATS == 1) */
+
+        /* Publish initialized pool. */
+        atomic_thread_fence (memory_order_release);
+
+        /* Succeed! */
+        ret = MEM_POOL_OK;
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPoolMt_alloc (memPoolMt_handle_t* ptrHandle, uint8_t** ptr2Slot)
+{
+    memPool_error_t ret;
+
+    /* Pop free list head, or take slot from bump pointer. */
+    ret = memPoolMt_get (ptrHandle, ptr2Slot);
+
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPoolMt_tryAlloc (memPoolMt_handle_t* ptrHandle, uint8_t** ptr2Slot)
+{
+    memPool_error_t ret;
+
+    /* Same as alloc, exhausted pool expected by caller. */
+    ret = memPoolMt_get (ptrHandle, ptr2Slot);
+
+    memPool_assert ((ret == MEM_POOL_OK) || (ret == MEM_POOL_ERROR_SPACE));
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPoolMt_free (memPoolMt_handle_t* ptrHandle, uint8_t* ptrSlot)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrHandle != NULL) && (ptrSlot != NULL));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrHandle != NULL) && (ptrSlot != NULL))
+    {
+        uint32_t idx;
+
+        /* Check that slot was allocated (and mark it as freed). */
+        ret = memPoolMt_release (ptrHandle, ptrSlot, &idx);
+
+        /* Succeed? */
+        if (ret == MEM_POOL_OK)
+        {
+            /* Push slot on free list. */
+            memPoolMt_pushChain (ptrHandle, idx, idx);
+        }
+        else
+        {
+            /* Just do nothing. */
+        }
+    }
+
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPoolMt_allocBulk (memPoolMt_handle_t* ptrHandle, uint8_t** ptrArray, uint32_t count, uint32_t* ptrGot)
+{
+    /* Slots cleared. */
+    return memPoolMt_take (ptrHandle, ptrArray, count, ptrGot, true);
+}
+
+memPool_error_t
+memPoolMt_allocBulkRaw (memPoolMt_handle_t* ptrHandle, uint8_t** ptrArray, uint32_t count, uint32_t* ptrGot)
+{
+    /* Slots handed out as is. */
+    return memPoolMt_take (ptrHandle, ptrArray, count, ptrGot, false);
+}
+
+memPool_error_t
+memPoolMt_freeBulk (memPoolMt_handle_t* ptrHandle, uint8_t* const* ptrArray, uint32_t count)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrHandle != NULL) && (ptrArray != NULL));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrHandle != NULL) && (ptrArray != NULL))
+    {
+        uint32_t i;
+        uint32_t idx;
+        uint32_t firstIdx;
+        uint32_t lastIdx;
+        bool     empty;
+
+        /* Clear error code. */
+        ret   = MEM_POOL_OK;
+        empty = true;
+
+        firstIdx = 0U;
+        lastIdx  = 0U;
+
+        /* Build a private chain (same order as freeing one by one). */
+        for (i = 0U; i < count; i++)
+        {
+            /* Check that slot was allocated (and mark it as freed). */
+            if ((ptrArray[i] != NULL) && (memPoolMt_release (ptrHandle, ptrArray[i], &idx) == MEM_POOL_OK))
+            {
+                if (empty == true)
+                {
+                    lastIdx = idx;
+                    empty   = false;
+                }
+                else
+                {
+                    atomic_store_explicit (memPoolMt_link (ptrHandle, idx), (firstIdx + 1U), memory_order_relaxed);
+                }
+
+                firstIdx = idx;
+            }
+            else
+            {
+                /* Error! Slot skipped, was not allocated! */
+                ret = MEM_POOL_ERROR_SLOT_NOT_ALLOCATED;
+            }
+        }
+
+        /* Splice chain on free list (single CAS). */
+        if (empty == false)
+        {
+            memPoolMt_pushChain (ptrHandle, firstIdx, lastIdx);
+        }
+    }
+
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+#if (defined MEM_POOL_STATS && (MEM_POOL_STATS == 1))
+memPool_error_t
+memPoolMt_getStats (memPoolMt_handle_t* ptrHandle, memPool_stats_t* ptrStats)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrHandle != NULL) && (ptrStats != NULL));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrHandle != NULL) && (ptrStats != NULL))
+    {
+        uint32_t i;
+
+        /* Sum shards. */
+        (void) memset (ptrStats, 0x00, sizeof (*ptrStats));
+
+        for (i = 0U; i < MEM_POOL_STATS_SHARDS; i++)
+        {
+            ptrStats->allocs        += atomic_load_explicit (&ptrHandle->stats[i].allocs,        memory_order_relaxed);
+            ptrStats->frees         += atomic_load_explicit (&ptrHandle->stats[i].frees,         memory_order_relaxed);
+            ptrStats->allocFailures += atomic_load_explicit (&ptrHandle->stats[i].allocFailures, memory_order_relaxed);
+            ptrStats->freeFailures  += atomic_load_explicit (&ptrHandle->stats[i].freeFailures,  memory_order_relaxed);
+        }
+
+        /* In use and its peak. */
+        ptrStats->inUse     = atomic_load_explicit (&ptrHandle->use.inUse,     memory_order_relaxed);
+        ptrStats->highWater = atomic_load_explicit (&ptrHandle->use.highWater, memory_order_relaxed);
+
+        /* Succeed! */
+        ret = MEM_POOL_OK;
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+#endif /* MEM_POOL_STATS && (MEM_POOL_STATS == 1) */
+
+/* ************************************************************************** *
+ *                       End of global function section                       *
+ * ************************************************************************** */
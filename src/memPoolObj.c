@@ -0,0 +1,256 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2021 Alessandro Morniroli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file   memPoolObj.c
+ * @author Alessandro Morniroli <alessandro.morniroli@gmail.com>
+ * @date   Sun Oct 18 2026
+ *
+ * @brief  Object memory pool implementation.
+ */
+
+/* ************************************************************************** *
+ *                         Start of includes section                          *
+ * ************************************************************************** */
+
+/* Standard C. */
+#include <stddef.h>
+/* Module include. */
+#include "memPool_priv.h"
+#include "memPoolObj.h"
+
+/* ************************************************************************** *
+ *                          End of includes section                           *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                    Start of private definitions section                    *
+ * ************************************************************************** */
+
+/**
+ * Object offset inside its slot (link word first).
+ */
+#define MEM_POOL_OBJ_OFFSET ((uint32_t) sizeof (uint8_t*))
+
+/* ************************************************************************** *
+ *                     End of private definitions section                     *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                    Start of external variables section                     *
+ * ************************************************************************** */
+
+/* ************************************************************************** *
+ *                     End of external variables section                      *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                     Start of private variables section                     *
+ * ************************************************************************** */
+
+/* ************************************************************************** *
+ *                      End of private variables section                      *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                Start of private function prototypes section                *
+ * ************************************************************************** */
+
+/* ************************************************************************** *
+ *                 End of private function prototypes section                 *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                     Start of private function section                      *
+ * ************************************************************************** */
+
+/* ************************************************************************** *
+ *                      End of private function section                       *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                      Start of global function section                      *
+ * ************************************************************************** */
+
+memPool_error_t
+memPoolObj_init (memPoolObj_handle_t* ptrHandle,
+                 uint8_t*             ptrStorage,
+                 uint32_t*            ptrBitmap,
+                 uint32_t             objectSize,
+                 uint32_t             objectNumber,
+                 memPoolObj_hook_t    construct,
+                 memPoolObj_hook_t    reset,
+                 memPoolObj_hook_t    destruct,
+                 void*                ptrContext)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrHandle != NULL) && (objectSize != 0U));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrHandle != NULL) && (objectSize != 0U))
+    {
+        /* Initialize slots (storage & number checked). */
+        ret = memPool_initBitmap (&ptrHandle->pool, ptrStorage, ptrBitmap,
+                                  MEM_POOL_OBJ_SLOT_SIZE (objectSize), objectNumber);
+
+    #if (defined memPool_zeroize && (memPool_zeroize == 1))
+        /* Objects keep their state: nothing cleared (but the link word). */
+        if (ret == MEM_POOL_OK)
+        {
+            ret = memPool_setZeroPolicy (&ptrHandle->pool, MEM_POOL_ZERO_PARTIAL, 0U);
+        }
+    #endif /* memPool_zeroize && (memPool_zeroize == 1) */
+
+        /* Copy hooks. */
+        ptrHandle->construct  = construct;
+        ptrHandle->reset      = reset;
+        ptrHandle->destruct   = destruct;
+        ptrHandle->ptrContext = ptrContext;
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPoolObj_alloc (memPoolObj_handle_t* ptrHandle, uint8_t** ptr2Object)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrHandle != NULL) && (ptr2Object != NULL));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrHandle != NULL) && (ptr2Object != NULL))
+    {
+        uint8_t* ptrSlot;
+        uint32_t bumpIndex;
+
+        /* Bump pointer moves only for slots never handed out. */
+        bumpIndex = ptrHandle->pool.bumpIndex;
+
+        ret = memPool_allocFrom (&ptrHandle->pool, &ptrSlot, memPool_caller ());
+
+        if (ret == MEM_POOL_OK)
+        {
+            *ptr2Object = &ptrSlot[MEM_POOL_OBJ_OFFSET];
+
+            /* New slot? Construct its object (once). */
+            if ((ptrHandle->pool.bumpIndex != bumpIndex) && (ptrHandle->construct != NULL))
+            {
+                ptrHandle->construct (ptrHandle->ptrContext, *ptr2Object);
+            }
+        }
+        else
+        {
+            /* Clear pointer. */
+            *ptr2Object = NULL;
+        }
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPoolObj_free (memPoolObj_handle_t* ptrHandle, uint8_t* ptrObject)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrHandle != NULL) && (ptrObject != NULL));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrHandle != NULL) && (ptrObject != NULL))
+    {
+        /* Link word is in front of the object: object is left untouched. */
+        ret = memPool_freeFrom (&ptrHandle->pool, (ptrObject - MEM_POOL_OBJ_OFFSET), memPool_caller ());
+
+        /* Freed? Reset object (still constructed). */
+        if ((ret == MEM_POOL_OK) && (ptrHandle->reset != NULL))
+        {
+            ptrHandle->reset (ptrHandle->ptrContext, ptrObject);
+        }
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPoolObj_deinit (memPoolObj_handle_t* ptrHandle)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert (ptrHandle != NULL);
+
+    /* Check parameters (if defined). */
+    memPool_checkParam (ptrHandle != NULL)
+    {
+        uint32_t i;
+
+        /* Objects constructed are those of the slots ever handed out. */
+        if (ptrHandle->destruct != NULL)
+        {
+            for (i = 0U; i < ptrHandle->pool.bumpIndex; i++)
+            {
+                ptrHandle->destruct (ptrHandle->ptrContext,
+                                     &ptrHandle->pool.ptrStorage[((i * ptrHandle->pool.slotSize) + MEM_POOL_OBJ_OFFSET)]);
+            }
+        }
+
+        /* No slot left (init again to reuse). */
+        ptrHandle->pool.ptrHead   = NULL;
+        ptrHandle->pool.bumpIndex = ptrHandle->pool.slotNumber;
+
+        /* Succeed! */
+        ret = MEM_POOL_OK;
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+/* ************************************************************************** *
+ *                       End of global function section                       *
+ * ************************************************************************** */
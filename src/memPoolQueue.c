@@ -0,0 +1,478 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2021 Alessandro Morniroli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file   memPoolQueue.c
+ * @author Alessandro Morniroli <alessandro.morniroli@gmail.com>
+ * @date   Sun Oct 18 2026
+ *
+ * @brief  Bounded slot queue (SPSC / MPMC) over a lock-free memory pool implementation.
+ */
+
+/* ************************************************************************** *
+ *                         Start of includes section                          *
+ * ************************************************************************** */
+
+/* Standard C. */
+#include <stddef.h>
+#include <string.h>
+/* Module include. */
+#include "memPool_priv.h"
+#include "memPoolQueue.h"
+
+/* ************************************************************************** *
+ *                          End of includes section                           *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                    Start of private definitions section                    *
+ * ************************************************************************** */
+
+/**
+ * Slot of a pool slot index, and back.
+ */
+#define memPoolQueue_slot(pP, idx)  (&(pP)->ptrStorage[((size_t) (idx)) * (pP)->slotSize])
+#define memPoolQueue_index(pP, pS)  ((uint32_t) (((uintptr_t) ((pS) - (pP)->ptrStorage)) / (pP)->slotSize))
+
+/* ************************************************************************** *
+ *                     End of private definitions section                     *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                    Start of external variables section                     *
+ * ************************************************************************** */
+
+/* ************************************************************************** *
+ *                     End of external variables section                      *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                     Start of private variables section                     *
+ * ************************************************************************** */
+
+/* ************************************************************************** *
+ *                      End of private variables section                      *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                Start of private function prototypes section                *
+ * ************************************************************************** */
+
+static bool
+memPoolQueue_isSlot (const memPoolMt_handle_t* ptrPool, const uint8_t* ptrSlot);
+
+static uint32_t
+memPoolQueue_reserve (memPoolQueue_handle_t* ptrHandle, bool produce, uint32_t count, bool exact, uint32_t* ptrPos);
+
+static void
+memPoolQueue_publish (memPoolQueue_handle_t* ptrHandle, bool produce, uint32_t pos, uint32_t count);
+
+/* ************************************************************************** *
+ *                 End of private function prototypes section                 *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                     Start of private function section                      *
+ * ************************************************************************** */
+
+/**
+ * @brief Check that a pointer is a slot of the pool (range & slot boundary).
+ */
+static bool
+memPoolQueue_isSlot (const memPoolMt_handle_t* ptrPool, const uint8_t* ptrSlot)
+{
+    uintptr_t offset;
+
+    /* Slot offset inside storage (wraps if below storage). */
+    offset = ((uintptr_t) ptrSlot) - ((uintptr_t) ptrPool->ptrStorage);
+
+    /* Return whether inside storage, on a slot boundary. */
+    return ((offset < (((uintptr_t) ptrPool->slotSize) * ptrPool->slotNumber)) &&
+            ((offset % ptrPool->slotSize) == 0U));
+}
+
+/**
+ * @brief Reserve up to \p count contiguous positions to enqueue (\p produce)
+ *        or to dequeue (\p exact: \p count positions or none).
+ *
+ * MPMC: cells ready for consecutive positions are counted, then the shared
+ * position is moved past them with one CAS. A cell ready for a position
+ * stays so until that position is reserved, thus reserved cells are owned.
+ * A cell a lap behind means full (empty); a cell ahead means the position
+ * read is stale (reserved by another thread), which is retried.
+ *
+ * @return Number of positions reserved, the first one stored into \p ptrPos.
+ */
+static uint32_t
+memPoolQueue_reserve (memPoolQueue_handle_t* ptrHandle, bool produce, uint32_t count, bool exact, uint32_t* ptrPos)
+{
+    _Atomic uint32_t* ptrShared;
+    uint32_t          number;
+    uint32_t          lap;
+    bool              done;
+
+    ptrShared = (produce == true) ? &ptrHandle->tail : &ptrHandle->head;
+    number    = 0U;
+
+    /* Single producer / consumer? */
+    if (ptrHandle->mode == MEM_POOL_QUEUE_SPSC)
+    {
+        /* Own position, other side cached (reloaded only if short). */
+        *ptrPos = atomic_load_explicit (ptrShared, memory_order_relaxed);
+
+        if (produce == true)
+        {
+            number = (ptrHandle->mask + 1U) - (*ptrPos - ptrHandle->headCache);
+
+            if (number < count)
+            {
+                ptrHandle->headCache = atomic_load_explicit (&ptrHandle->head, memory_order_acquire);
+                number               = (ptrHandle->mask + 1U) - (*ptrPos - ptrHandle->headCache);
+            }
+        }
+        else
+        {
+            number = ptrHandle->tailCache - *ptrPos;
+
+            if (number < count)
+            {
+                ptrHandle->tailCache = atomic_load_explicit (&ptrHandle->tail, memory_order_acquire);
+                number               = ptrHandle->tailCache - *ptrPos;
+            }
+        }
+
+        number = (number < count) ? number : count;
+        number = ((exact == true) && (number != count)) ? 0U : number;
+    }
+    else
+    {
+        /* Cell is free for position p at lap p, full at lap p + 1. */
+        lap     = (produce == true) ? 0U : 1U;
+        *ptrPos = atomic_load_explicit (ptrShared, memory_order_relaxed);
+        done    = false;
+
+        while (done == false)
+        {
+            uint32_t seq;
+            int32_t  dif;
+
+            /* Count ready cells (dif: distance of first cell not ready from its expected sequence). */
+            number = 0U;
+            dif    = 0;
+
+            while ((number < count) && (dif == 0))
+            {
+                seq     = atomic_load_explicit (&ptrHandle->ptrCells[(*ptrPos + number) & ptrHandle->mask].seq,
+                                                memory_order_acquire);
+                dif     = (int32_t) (seq - (*ptrPos + number + lap));
+                number += (dif == 0) ? 1U : 0U;
+            }
+
+            /* Cell ahead: position taken by another thread since read, reload it. */
+            if (dif > 0)
+            {
+                *ptrPos = atomic_load_explicit (ptrShared, memory_order_relaxed);
+            }
+            else
+            {
+                /* Cell behind (if any): queue full / empty from there. */
+                number = ((exact == true) && (number != count)) ? 0U : number;
+
+                /* Move shared position (on failure position is reloaded, nothing to do if none ready). */
+                done = (number == 0U) ||
+                       atomic_compare_exchange_weak_explicit (ptrShared, ptrPos, (*ptrPos + number),
+                                                              memory_order_relaxed, memory_order_relaxed);
+            }
+        }
+    }
+
+    /* Return the number of positions reserved. */
+    return number;
+}
+
+/**
+ * @brief Publish \p count positions from \p pos, once enqueued (\p produce)
+ *        or dequeued.
+ */
+static void
+memPoolQueue_publish (memPoolQueue_handle_t* ptrHandle, bool produce, uint32_t pos, uint32_t count)
+{
+    uint32_t i;
+
+    /* Single producer / consumer? */
+    if (ptrHandle->mode == MEM_POOL_QUEUE_SPSC)
+    {
+        /* Move own position past cells. */
+        atomic_store_explicit (((produce == true) ? &ptrHandle->tail : &ptrHandle->head), (pos + count),
+                               memory_order_release);
+    }
+    else
+    {
+        /* Cells full for the consumer of each position, or free for the producer a lap later. */
+        for (i = 0U; i < count; i++)
+        {
+            atomic_store_explicit (&ptrHandle->ptrCells[(pos + i) & ptrHandle->mask].seq,
+                                   ((produce == true) ? (pos + i + 1U) : (pos + i + ptrHandle->mask + 1U)),
+                                   memory_order_release);
+        }
+    }
+}
+
+/* ************************************************************************** *
+ *                      End of private function section                       *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                      Start of global function section                      *
+ * ************************************************************************** */
+
+memPool_error_t
+memPoolQueue_init (memPoolQueue_handle_t* ptrHandle,
+                   memPoolMt_handle_t*    ptrPool,
+                   memPoolQueue_cell_t*   ptrCells,
+                   uint32_t               capacity,
+                   memPoolQueue_mode_t    mode)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrHandle != NULL)                        &&
+                    (ptrPool   != NULL)                        &&
+                    (ptrCells  != NULL)                        &&
+                    (capacity  != 0U)                          &&
+                    (capacity  <= 0x80000000U)                 &&
+                    ((capacity & (capacity - 1U)) == 0U)       &&
+                    ((mode == MEM_POOL_QUEUE_SPSC) || (mode == MEM_POOL_QUEUE_MPMC)));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrHandle != NULL)                        &&
+                        (ptrPool   != NULL)                        &&
+                        (ptrCells  != NULL)                        &&
+                        (capacity  != 0U)                          &&
+                        (capacity  <= 0x80000000U)                 &&
+                        ((capacity & (capacity - 1U)) == 0U)       &&
+                        ((mode == MEM_POOL_QUEUE_SPSC) || (mode == MEM_POOL_QUEUE_MPMC)))
+    {
+        uint32_t i;
+
+        /* Each cell free for its first lap position. */
+        for (i = 0U; i < capacity; i++)
+        {
+            atomic_init (&ptrCells[i].seq, i);
+            ptrCells[i].idx = 0U;
+        }
+
+        /* Copy queue info (empty). */
+        atomic_init (&ptrHandle->tail, 0U);
+        atomic_init (&ptrHandle->head, 0U);
+        ptrHandle->headCache = 0U;
+        ptrHandle->tailCache = 0U;
+        ptrHandle->ptrPool   = ptrPool;
+        ptrHandle->ptrCells  = ptrCells;
+        ptrHandle->mask      = capacity - 1U;
+        ptrHandle->mode      = mode;
+
+        /* Publish initialized queue. */
+        atomic_thread_fence (memory_order_release);
+
+        /* Succeed! */
+        ret = MEM_POOL_OK;
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPoolQueue_enqueue (memPoolQueue_handle_t* ptrHandle, uint8_t* ptrSlot)
+{
+    /* Batch of one slot. */
+    return memPoolQueue_enqueueBulk (ptrHandle, &ptrSlot, 1U, NULL);
+}
+
+memPool_error_t
+memPoolQueue_dequeue (memPoolQueue_handle_t* ptrHandle, uint8_t** ptr2Slot)
+{
+    /* Batch of one slot. */
+    return memPoolQueue_dequeueBulk (ptrHandle, ptr2Slot, 1U, NULL);
+}
+
+memPool_error_t
+memPoolQueue_enqueueBulk (memPoolQueue_handle_t* ptrHandle,
+                          uint8_t* const*        ptrArray,
+                          uint32_t               count,
+                          uint32_t*              ptrDone)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrHandle != NULL) && (ptrArray != NULL));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrHandle != NULL) && (ptrArray != NULL))
+    {
+        uint32_t i;
+        uint32_t pos;
+        uint32_t number;
+
+        /* Clear error code. */
+        ret    = MEM_POOL_OK;
+        number = 0U;
+
+        /* All slots of the pool? */
+        for (i = 0U; (i < count) && (ret == MEM_POOL_OK); i++)
+        {
+            if ((ptrArray[i] == NULL) || (memPoolQueue_isSlot (ptrHandle->ptrPool, ptrArray[i]) == false))
+            {
+                /* Error! Slot was not allocated! */
+                ret = MEM_POOL_ERROR_SLOT_NOT_ALLOCATED;
+            }
+        }
+
+        if (ret == MEM_POOL_OK)
+        {
+            /* Reserve cells (one position update). */
+            number = memPoolQueue_reserve (ptrHandle, true, count, (ptrDone == NULL), &pos);
+
+            /* Store slot indices. */
+            for (i = 0U; i < number; i++)
+            {
+                ptrHandle->ptrCells[(pos + i) & ptrHandle->mask].idx = memPoolQueue_index (ptrHandle->ptrPool,
+                                                                                           ptrArray[i]);
+            }
+
+            /* Hand cells to consumers. */
+            memPoolQueue_publish (ptrHandle, true, pos, number);
+
+            /* Succeed if all slots (best effort: any slot) were enqueued. */
+            ret = ((number == count) || ((number != 0U) && (ptrDone != NULL))) ? MEM_POOL_OK : MEM_POOL_ERROR_SPACE;
+        }
+
+        /* Store number of slots enqueued. */
+        if (ptrDone != NULL)
+        {
+            *ptrDone = number;
+        }
+    }
+
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPoolQueue_dequeueBulk (memPoolQueue_handle_t* ptrHandle, uint8_t** ptrArray, uint32_t count, uint32_t* ptrGot)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrHandle != NULL) && (ptrArray != NULL));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrHandle != NULL) && (ptrArray != NULL))
+    {
+        uint32_t i;
+        uint32_t pos;
+        uint32_t number;
+
+        /* Reserve cells (one position update). */
+        number = memPoolQueue_reserve (ptrHandle, false, count, (ptrGot == NULL), &pos);
+
+        /* Load slots. */
+        for (i = 0U; i < number; i++)
+        {
+            ptrArray[i] = memPoolQueue_slot (ptrHandle->ptrPool, ptrHandle->ptrCells[(pos + i) & ptrHandle->mask].idx);
+        }
+
+        /* Hand cells back to producers. */
+        memPoolQueue_publish (ptrHandle, false, pos, number);
+
+        /* Clear unused entries. */
+        (void) memset (&ptrArray[number], 0x00, ((count - number) * sizeof (*ptrArray)));
+
+        /* Store number of slots dequeued. */
+        if (ptrGot != NULL)
+        {
+            *ptrGot = number;
+        }
+
+        /* Succeed if all slots (best effort: any slot) were dequeued. */
+        ret = ((number == count) || ((number != 0U) && (ptrGot != NULL))) ? MEM_POOL_OK : MEM_POOL_ERROR_SPACE;
+    }
+
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPoolQueue_release (memPoolQueue_handle_t* ptrHandle, uint8_t* ptrSlot)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert (ptrHandle != NULL);
+
+    /* Check parameters (if defined). */
+    memPool_checkParam (ptrHandle != NULL)
+    {
+        /* Free slot into originating pool. */
+        ret = memPoolMt_free (ptrHandle->ptrPool, ptrSlot);
+    }
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPoolQueue_releaseBulk (memPoolQueue_handle_t* ptrHandle, uint8_t* const* ptrArray, uint32_t count)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert (ptrHandle != NULL);
+
+    /* Check parameters (if defined). */
+    memPool_checkParam (ptrHandle != NULL)
+    {
+        /* Free slots into originating pool (single CAS). */
+        ret = memPoolMt_freeBulk (ptrHandle->ptrPool, ptrArray, count);
+    }
+
+    /* Return the function result code. */
+    return ret;
+}
+
+/* ************************************************************************** *
+ *                       End of global function section                       *
+ * ************************************************************************** */
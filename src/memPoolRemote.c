@@ -0,0 +1,317 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2021 Alessandro Morniroli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file   memPoolRemote.c
+ * @author Alessandro Morniroli <alessandro.morniroli@gmail.com>
+ * @date   Sun Oct 18 2026
+ *
+ * @brief  Memory pool with remote free queue implementation.
+ */
+
+/* ************************************************************************** *
+ *                         Start of includes section                          *
+ * ************************************************************************** */
+
+/* Standard C. */
+#include <stdatomic.h>
+#include <stddef.h>
+/* Module include. */
+#include "memPool_priv.h"
+#include "memPoolRemote.h"
+
+/* ************************************************************************** *
+ *                          End of includes section                           *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                    Start of private definitions section                    *
+ * ************************************************************************** */
+
+/* ************************************************************************** *
+ *                     End of private definitions section                     *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                    Start of external variables section                     *
+ * ************************************************************************** */
+
+/* ************************************************************************** *
+ *                     End of external variables section                      *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                     Start of private variables section                     *
+ * ************************************************************************** */
+
+/* ************************************************************************** *
+ *                      End of private variables section                      *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                Start of private function prototypes section                *
+ * ************************************************************************** */
+
+static bool
+memPoolRemote_exhausted (const memPool_handle_t* ptrPool);
+
+static memPool_error_t
+memPoolRemote_collect (memPoolRemote_handle_t* ptrHandle, uint32_t* ptrDrained, const void* ptrCaller);
+
+/* ************************************************************************** *
+ *                 End of private function prototypes section                 *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                     Start of private function section                      *
+ * ************************************************************************** */
+
+/**
+ * @brief Check whether owner pool has no slot left (alloc would miss).
+ */
+static bool
+memPoolRemote_exhausted (const memPool_handle_t* ptrPool)
+{
+    bool exhausted;
+
+    /* Free lists empty and no slot left to bump? */
+    exhausted = (ptrPool->ptrHead   == NULL) &&
+                (ptrPool->indexTop  == 0U)   &&
+                (ptrPool->bumpIndex == ptrPool->slotNumber);
+
+#if (defined memPool_zeroize && (memPool_zeroize == 1))
+    exhausted = exhausted && (ptrPool->ptrDirty == NULL);
+#endif /* memPool_zeroize && (memPool_zeroize == 1) */
+
+    /* Return whether pool is exhausted. */
+    return exhausted;
+}
+
+/**
+ * @brief Take back slots freed by other threads, on behalf of \p ptrCaller.
+ */
+static memPool_error_t
+memPoolRemote_collect (memPoolRemote_handle_t* ptrHandle, uint32_t* ptrDrained, const void* ptrCaller)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert (ptrHandle != NULL);
+
+    /* Check parameters (if defined). */
+    memPool_checkParam (ptrHandle != NULL)
+    {
+        uint8_t* ptrSlot;
+        uint8_t* ptrNext;
+        uint32_t n;
+
+        /* Clear error code. */
+        ret = MEM_POOL_OK;
+        n   = 0U;
+
+        /* Take whole queue (single consumer: no ABA). */
+        ptrSlot = atomic_exchange_explicit (&ptrHandle->remoteHead, NULL, memory_order_acquire);
+
+        while (ptrSlot != NULL)
+        {
+            /* Next first: free overwrites the link. */
+            ptrNext = *((uint8_t**) ptrSlot);
+
+            /* Free into owner pool (slot checked here). */
+            if (memPool_freeFrom (&ptrHandle->pool, ptrSlot, ptrCaller) == MEM_POOL_OK)
+            {
+                n++;
+            }
+            else
+            {
+                /* Error! Slot skipped, was not allocated! */
+                ret = MEM_POOL_ERROR_SLOT_NOT_ALLOCATED;
+            }
+
+            ptrSlot = ptrNext;
+        }
+
+        /* Store number of slots drained. */
+        if (ptrDrained != NULL)
+        {
+            *ptrDrained = n;
+        }
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+/* ************************************************************************** *
+ *                      End of private function section                       *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                      Start of global function section                      *
+ * ************************************************************************** */
+
+memPool_error_t
+memPoolRemote_init (memPoolRemote_handle_t* ptrHandle,
+                    uint8_t*                ptrStorage,
+                    uint32_t*               ptrBitmap,
+                    uint32_t                slotSize,
+                    uint32_t                slotNumber)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert (ptrHandle != NULL);
+
+    /* Check parameters (if defined). */
+    memPool_checkParam (ptrHandle != NULL)
+    {
+        /* Initialize owner pool (parameters checked). */
+        ret = memPool_initBitmap (&ptrHandle->pool, ptrStorage, ptrBitmap, slotSize, slotNumber);
+
+        /* Remote free queue empty. */
+        atomic_init (&ptrHandle->remoteHead, NULL);
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPoolRemote_alloc (memPoolRemote_handle_t* ptrHandle, uint8_t** ptr2Slot)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrHandle != NULL) && (ptr2Slot != NULL));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrHandle != NULL) && (ptr2Slot != NULL))
+    {
+        /* Miss? Take back slots freed by other threads (the only atomic on this path). */
+        if (memPoolRemote_exhausted (&ptrHandle->pool) == true)
+        {
+            (void) memPoolRemote_collect (ptrHandle, NULL, memPool_caller ());
+        }
+
+        /* Unsynchronized alloc. */
+        ret = memPool_allocFrom (&ptrHandle->pool, ptr2Slot, memPool_caller ());
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPoolRemote_free (memPoolRemote_handle_t* ptrHandle, uint8_t* ptrSlot)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert (ptrHandle != NULL);
+
+    /* Check parameters (if defined). */
+    memPool_checkParam (ptrHandle != NULL)
+    {
+        /* Unsynchronized free. */
+        ret = memPool_freeFrom (&ptrHandle->pool, ptrSlot, memPool_caller ());
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPoolRemote_freeRemote (memPoolRemote_handle_t* ptrHandle, uint8_t* ptrSlot)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrHandle != NULL) && (ptrSlot != NULL));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrHandle != NULL) && (ptrSlot != NULL))
+    {
+        uintptr_t offset;
+
+        /* Slot offset inside pool storage (wraps if below storage). */
+        offset = ((uintptr_t) ptrSlot) - ((uintptr_t) ptrHandle->pool.ptrStorage);
+
+        /* Inside pool, on a slot boundary (storage & geometry never change: safe to read)? */
+        if ((offset < (((uintptr_t) ptrHandle->pool.slotSize) * ptrHandle->pool.slotNumber)) &&
+            ((offset % ptrHandle->pool.slotSize) == 0U))
+        {
+            uint8_t* head;
+
+            head = atomic_load_explicit (&ptrHandle->remoteHead, memory_order_relaxed);
+
+            /* Push: link to current head, publish slot (retried on contention only). */
+            do
+            {
+                *((uint8_t**) ptrSlot) = head;
+            } while (atomic_compare_exchange_weak_explicit (&ptrHandle->remoteHead, &head, ptrSlot,
+                                                            memory_order_release, memory_order_relaxed) == false);
+
+            /* Succeed! */
+            ret = MEM_POOL_OK;
+        }
+        else
+        {
+            /* Error! Slot is outside pool or not on a slot boundary! */
+            ret = MEM_POOL_ERROR_SLOT_NOT_ALLOCATED;
+        }
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPoolRemote_drain (memPoolRemote_handle_t* ptrHandle, uint32_t* ptrDrained)
+{
+    /* Drain on behalf of our caller. */
+    return memPoolRemote_collect (ptrHandle, ptrDrained, memPool_caller ());
+}
+
+/* ************************************************************************** *
+ *                       End of global function section                       *
+ * ************************************************************************** */
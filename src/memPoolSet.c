@@ -0,0 +1,273 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2021 Alessandro Morniroli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file   memPoolSet.c
+ * @author Alessandro Morniroli <alessandro.morniroli@gmail.com>
+ * @date   Sun Oct 18 2026
+ *
+ * @brief  Multi size class memory pool implementation.
+ */
+
+/* ************************************************************************** *
+ *                         Start of includes section                          *
+ * ************************************************************************** */
+
+/* Standard C. */
+#include <stddef.h>
+/* Module include. */
+#include "memPool_priv.h"
+#include "memPoolSet.h"
+
+/* ************************************************************************** *
+ *                          End of includes section                           *
+ * ************************************************************************** */
+
+#if (defined MEM_POOL_SET_CLASSES && (MEM_POOL_SET_CLASSES > 0))
+
+
+/* ************************************************************************** *
+ *                    Start of private definitions section                    *
+ * ************************************************************************** */
+
+/**
+ * No class for a size (lookup table).
+ */
+#define MEM_POOL_SET_NO_CLASS 0xFFU
+
+/* ************************************************************************** *
+ *                     End of private definitions section                     *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                    Start of external variables section                     *
+ * ************************************************************************** */
+
+/* ************************************************************************** *
+ *                     End of external variables section                      *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                     Start of private variables section                     *
+ * ************************************************************************** */
+
+/* ************************************************************************** *
+ *                      End of private variables section                      *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                Start of private function prototypes section                *
+ * ************************************************************************** */
+
+/* ************************************************************************** *
+ *                 End of private function prototypes section                 *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                     Start of private function section                      *
+ * ************************************************************************** */
+
+/* ************************************************************************** *
+ *                      End of private function section                       *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                      Start of global function section                      *
+ * ************************************************************************** */
+
+memPool_error_t
+memPoolSet_init (memPoolSet_handle_t*      ptrHandle,
+                 uint8_t*                  ptrStorage,
+                 uint32_t                  storageSize,
+                 const memPoolSet_class_t* ptrClasses,
+                 uint32_t                  classNumber)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrHandle   != NULL) &&
+                    (ptrStorage  != NULL) &&
+                    (ptrClasses  != NULL) &&
+                    (classNumber != 0U)   &&
+                    (classNumber <= MEM_POOL_SET_CLASSES));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrHandle   != NULL) &&
+                        (ptrStorage  != NULL) &&
+                        (ptrClasses  != NULL) &&
+                        (classNumber != 0U)   &&
+                        (classNumber <= MEM_POOL_SET_CLASSES))
+    {
+        uint32_t c;
+        uint32_t g;
+        uint32_t offset;
+
+        /* Clear error code. */
+        ret    = MEM_POOL_OK;
+        offset = 0U;
+
+        /* Lay classes out, one after the other. */
+        for (c = 0U; (c < classNumber) && (ret == MEM_POOL_OK); c++)
+        {
+            /* Wrong class (too small, not ascending, not granule multiple, too big or no space)? */
+            if ((ptrClasses[c].slotSize < sizeof (uint8_t*))                          ||
+                ((c != 0U) && (ptrClasses[c].slotSize <= ptrClasses[c - 1U].slotSize)) ||
+                ((ptrClasses[c].slotSize % MEM_POOL_SET_GRANULE) != 0U)                ||
+                (ptrClasses[c].slotSize > MEM_POOL_SET_MAX_SLOT_SIZE)                  ||
+                (ptrClasses[c].slotNumber > ((storageSize - offset) / ptrClasses[c].slotSize)))
+            {
+                /* Error! Wrong class! */
+                ret = MEM_POOL_ERROR_PARAMETERS;
+            }
+            else
+            {
+                ret = memPool_init (&ptrHandle->pools[c],
+                                    &ptrStorage[offset],
+                                    ptrClasses[c].slotSize,
+                                    ptrClasses[c].slotNumber);
+
+                offset += ptrClasses[c].slotSize * ptrClasses[c].slotNumber;
+
+                ptrHandle->ptrEnd[c] = &ptrStorage[offset];
+            }
+        }
+
+        /* Succeed? */
+        if (ret == MEM_POOL_OK)
+        {
+            /* Build lookup table: smallest class fitting each granule. */
+            ptrHandle->classNumber = classNumber;
+            c                      = 0U;
+
+            for (g = 0U; g < (sizeof (ptrHandle->lookup) / sizeof (ptrHandle->lookup[0])); g++)
+            {
+                while ((c < classNumber) && (ptrClasses[c].slotSize < (g * MEM_POOL_SET_GRANULE)))
+                {
+                    c++;
+                }
+
+                ptrHandle->lookup[g] = (c < classNumber) ? ((uint8_t) c) : MEM_POOL_SET_NO_CLASS;
+            }
+        }
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPoolSet_alloc (memPoolSet_handle_t* ptrHandle, uint32_t size, uint8_t** ptr2Slot)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrHandle != NULL) && (ptr2Slot != NULL) && (size <= MEM_POOL_SET_MAX_SLOT_SIZE));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrHandle != NULL) && (ptr2Slot != NULL) && (size <= MEM_POOL_SET_MAX_SLOT_SIZE))
+    {
+        uint32_t c;
+
+        /* Smallest class fitting size (O(1)). */
+        c = ptrHandle->lookup[((size + (MEM_POOL_SET_GRANULE - 1U)) / MEM_POOL_SET_GRANULE)];
+
+        /* Clear pointer. */
+        *ptr2Slot = NULL;
+
+        /* No class fits? */
+        if (c == MEM_POOL_SET_NO_CLASS)
+        {
+            /* Error! No slots big enough! */
+            ret = MEM_POOL_ERROR_SPACE;
+        }
+        else
+        {
+            /* Try class, then larger ones if exhausted. */
+            do
+            {
+                ret = memPool_allocFrom (&ptrHandle->pools[c], ptr2Slot, memPool_caller ());
+                c++;
+            } while ((ret == MEM_POOL_ERROR_SPACE) && (c < ptrHandle->classNumber));
+        }
+    }
+
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPoolSet_free (memPoolSet_handle_t* ptrHandle, uint8_t* ptrSlot)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrHandle != NULL) && (ptrSlot != NULL));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrHandle != NULL) && (ptrSlot != NULL))
+    {
+        uintptr_t offset;
+        uint32_t  c;
+
+        /* Find class from address range (classes are contiguous and few). */
+        offset = ((uintptr_t) ptrSlot) - ((uintptr_t) ptrHandle->pools[0].ptrStorage);
+        c      = 0U;
+
+        while ((c < ptrHandle->classNumber) &&
+               (offset >= (((uintptr_t) ptrHandle->ptrEnd[c]) - ((uintptr_t) ptrHandle->pools[0].ptrStorage))))
+        {
+            c++;
+        }
+
+        /* Inside a class? */
+        if (c < ptrHandle->classNumber)
+        {
+            ret = memPool_freeFrom (&ptrHandle->pools[c], ptrSlot, memPool_caller ());
+        }
+        else
+        {
+            /* Error! Slot is outside every class! */
+            ret = MEM_POOL_ERROR_SLOT_NOT_ALLOCATED;
+        }
+    }
+
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+/* ************************************************************************** *
+ *                       End of global function section                       *
+ * ************************************************************************** */
+
+#endif /* defined MEM_POOL_SET_CLASSES && (MEM_POOL_SET_CLASSES > 0) */
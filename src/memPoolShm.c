@@ -0,0 +1,635 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2021 Alessandro Morniroli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file   memPoolShm.c
+ * @author Alessandro Morniroli <alessandro.morniroli@gmail.com>
+ * @date   Sun Oct 18 2026
+ *
+ * @brief  Process-shared (POSIX shared memory) lock-free memory pool implementation.
+ */
+
+/* ************************************************************************** *
+ *                         Start of includes section                          *
+ * ************************************************************************** */
+
+/* Feature test (shm_open, ftruncate). */
+#define _POSIX_C_SOURCE 200809L
+
+/* Standard C. */
+#include <stddef.h>
+#include <string.h>
+/* POSIX. */
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+/* Module include. */
+#include "memPool_priv.h"
+#include "memPoolShm.h"
+
+/* ************************************************************************** *
+ *                          End of includes section                           *
+ * ************************************************************************** */
+
+#if (defined MEM_POOL_SHM && (MEM_POOL_SHM == 1))
+
+
+/* ************************************************************************** *
+ *                    Start of private definitions section                    *
+ * ************************************************************************** */
+
+/**
+ * Tagged head helpers (index is stored plus one, zero means empty list).
+ */
+#define memPoolShm_headIndex(head)    ((uint32_t) ((head) & 0xFFFFFFFFU))
+#define memPoolShm_headTag(head)      ((uint32_t) ((head) >> 32U))
+#define memPoolShm_headMake(tag, idx) ((((uint64_t) (tag)) << 32U) | ((uint64_t) (idx)))
+
+/**
+ * Allocation bitmap and slot of a handle (located from the handle address).
+ */
+#define memPoolShm_bitmap(pH)    ((_Atomic uint32_t*) &((uint8_t*) (pH))[(pH)->bitmapOffset])
+#define memPoolShm_ptr(pH, idx)  (&((uint8_t*) (pH))[(pH)->storageOffset + (((uint64_t) (idx)) * (pH)->slotSize)])
+
+/**
+ * Free list link (index of next slot plus one) stored in the slot itself.
+ */
+#define memPoolShm_link(pH, idx) ((_Atomic uint32_t*) memPoolShm_ptr ((pH), (idx)))
+
+/* ************************************************************************** *
+ *                     End of private definitions section                     *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                    Start of external variables section                     *
+ * ************************************************************************** */
+
+/* ************************************************************************** *
+ *                     End of external variables section                      *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                     Start of private variables section                     *
+ * ************************************************************************** */
+
+/* ************************************************************************** *
+ *                      End of private variables section                      *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                Start of private function prototypes section                *
+ * ************************************************************************** */
+
+static memPool_error_t
+memPoolShm_slotIndex (const memPoolShm_handle_t* ptrHandle, uint64_t offset, uint32_t* ptrIdx);
+
+static bool
+memPoolShm_lockFree (memPoolShm_handle_t* ptrHandle);
+
+/* ************************************************************************** *
+ *                 End of private function prototypes section                 *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                     Start of private function section                      *
+ * ************************************************************************** */
+
+/**
+ * @brief Get index of the slot at an offset (from region start).
+ *
+ * @return MEM_POOL_OK if offset is a slot boundary of a slot handed out;
+ *         MEM_POOL_ERROR_SLOT_NOT_ALLOCATED otherwise.
+ */
+static memPool_error_t
+memPoolShm_slotIndex (const memPoolShm_handle_t* ptrHandle, uint64_t offset, uint32_t* ptrIdx)
+{
+    memPool_error_t ret;
+
+    /* Offset inside storage (wraps if below storage). */
+    offset -= ptrHandle->storageOffset;
+    *ptrIdx = (uint32_t) (offset / ptrHandle->slotSize);
+
+    /* Outside pool, not on a slot boundary or never handed out? */
+    if ((offset >= (((uint64_t) ptrHandle->slotSize) * ptrHandle->slotNumber)) ||
+        ((offset % ptrHandle->slotSize) != 0U)                                 ||
+        (*ptrIdx >= atomic_load_explicit (&ptrHandle->bumpIndex, memory_order_relaxed)))
+    {
+        /* Error! Slot was not allocated! */
+        ret = MEM_POOL_ERROR_SLOT_NOT_ALLOCATED;
+    }
+    else
+    {
+        /* Succeed! */
+        ret = MEM_POOL_OK;
+    }
+
+    /* Return the function result code. */
+    return ret;
+}
+
+/**
+ * @brief Check that shared atomics are lock-free (thus address free, so that
+ *        they work across processes).
+ */
+static bool
+memPoolShm_lockFree (memPoolShm_handle_t* ptrHandle)
+{
+    /* Return whether head and bump pointer updates are lock-free. */
+    return (atomic_is_lock_free (&ptrHandle->head) && atomic_is_lock_free (&ptrHandle->bumpIndex));
+}
+
+/* ************************************************************************** *
+ *                      End of private function section                       *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                      Start of global function section                      *
+ * ************************************************************************** */
+
+memPool_error_t
+memPoolShm_init (uint8_t*              ptrRegion,
+                 size_t                regionSize,
+                 uint32_t              slotSize,
+                 uint32_t              slotNumber,
+                 memPoolShm_handle_t** ptr2Handle)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrRegion  != NULL)                                            &&
+                    ((((uintptr_t) ptrRegion) % MEM_POOL_CACHE_LINE) == 0U)         &&
+                    (slotSize   != 0U)                                              &&
+                    ((slotSize % sizeof (uint32_t)) == 0U)                          &&
+                    (slotNumber != 0U)                                              &&
+                    (slotNumber <  UINT32_MAX)                                      &&
+                    (regionSize >= MEM_POOL_SHM_REGION_SIZE (slotSize, slotNumber)) &&
+                    (ptr2Handle != NULL));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrRegion  != NULL)                                            &&
+                        ((((uintptr_t) ptrRegion) % MEM_POOL_CACHE_LINE) == 0U)         &&
+                        (slotSize   != 0U)                                              &&
+                        ((slotSize % sizeof (uint32_t)) == 0U)                          &&
+                        (slotNumber != 0U)                                              &&
+                        (slotNumber <  UINT32_MAX)                                      &&
+                        (regionSize >= MEM_POOL_SHM_REGION_SIZE (slotSize, slotNumber)) &&
+                        (ptr2Handle != NULL))
+    {
+        memPoolShm_handle_t* ptrHandle;
+        uint32_t             i;
+
+        ptrHandle = (memPoolShm_handle_t*) ptrRegion;
+
+        /* Cross-process atomics supported? */
+        if (memPoolShm_lockFree (ptrHandle) == true)
+        {
+            /* Lay out pool (bitmap, then storage, right after handle). */
+            ptrHandle->slotSize      = slotSize;
+            ptrHandle->slotNumber    = slotNumber;
+            ptrHandle->bitmapOffset  = (uint32_t) sizeof (memPoolShm_handle_t);
+            ptrHandle->storageOffset = sizeof (memPoolShm_handle_t) + MEM_POOL_SHM_BITMAP_SIZE (slotNumber);
+            ptrHandle->regionSize    = MEM_POOL_SHM_REGION_SIZE (slotSize, slotNumber);
+
+            /* No slots allocated (storage is handed out by bump pointer first). */
+            for (i = 0U; i < MEM_POOL_BITMAP_WORDS (slotNumber); i++)
+            {
+                atomic_init (&memPoolShm_bitmap (ptrHandle)[i], 0U);
+            }
+
+            atomic_init (&ptrHandle->head,      memPoolShm_headMake (0U, 0U));
+            atomic_init (&ptrHandle->bumpIndex, 0U);
+
+            /* Publish initialized pool (to processes attaching). */
+            atomic_store_explicit (&ptrHandle->magic, MEM_POOL_SHM_MAGIC, memory_order_release);
+
+            *ptr2Handle = ptrHandle;
+
+            /* Succeed! */
+            ret = MEM_POOL_OK;
+        }
+        else
+        {
+            /* Error! Atomics would not be shared! */
+            ret = MEM_POOL_ERROR_PARAMETERS;
+        }
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPoolShm_attach (uint8_t* ptrRegion, size_t regionSize, memPoolShm_handle_t** ptr2Handle)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrRegion  != NULL)                                    &&
+                    ((((uintptr_t) ptrRegion) % MEM_POOL_CACHE_LINE) == 0U) &&
+                    (regionSize >= sizeof (memPoolShm_handle_t))            &&
+                    (ptr2Handle != NULL));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrRegion  != NULL)                                    &&
+                        ((((uintptr_t) ptrRegion) % MEM_POOL_CACHE_LINE) == 0U) &&
+                        (regionSize >= sizeof (memPoolShm_handle_t))            &&
+                        (ptr2Handle != NULL))
+    {
+        memPoolShm_handle_t* ptrHandle;
+
+        ptrHandle = (memPoolShm_handle_t*) ptrRegion;
+
+        /* Initialized pool, laid out as by init and fitting in region? */
+        if ((memPoolShm_lockFree (ptrHandle) == true)                                                  &&
+            (atomic_load_explicit (&ptrHandle->magic, memory_order_acquire) == MEM_POOL_SHM_MAGIC)     &&
+            (ptrHandle->slotSize   != 0U)                                                              &&
+            ((ptrHandle->slotSize % sizeof (uint32_t)) == 0U)                                          &&
+            (ptrHandle->slotNumber != 0U)                                                              &&
+            (ptrHandle->slotNumber <  UINT32_MAX)                                                      &&
+            (ptrHandle->bitmapOffset  == sizeof (memPoolShm_handle_t))                                 &&
+            (ptrHandle->storageOffset == (ptrHandle->bitmapOffset +
+                                          MEM_POOL_SHM_BITMAP_SIZE (ptrHandle->slotNumber)))           &&
+            (ptrHandle->regionSize    == (ptrHandle->storageOffset +
+                                          (((uint64_t) ptrHandle->slotSize) * ptrHandle->slotNumber))) &&
+            (ptrHandle->regionSize    <= regionSize))
+        {
+            *ptr2Handle = ptrHandle;
+
+            /* Succeed! */
+            ret = MEM_POOL_OK;
+        }
+        else
+        {
+            /* Error! No (valid) pool in region! */
+            ret = MEM_POOL_ERROR_CORRUPTED;
+        }
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPoolShm_create (const char* name, uint32_t slotSize, uint32_t slotNumber, memPoolShm_handle_t** ptr2Handle)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((name != NULL) && (slotSize != 0U) && (slotNumber != 0U) && (ptr2Handle != NULL));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((name != NULL) && (slotSize != 0U) && (slotNumber != 0U) && (ptr2Handle != NULL))
+    {
+        size_t size;
+        void*  ptr;
+        int    fd;
+
+        size = MEM_POOL_SHM_REGION_SIZE (slotSize, slotNumber);
+        ptr  = MAP_FAILED;
+
+        /* Create object (zero filled) and map it. */
+        fd = shm_open (name, (O_CREAT | O_EXCL | O_RDWR), (S_IRUSR | S_IWUSR));
+
+        if ((fd >= 0) && (ftruncate (fd, (off_t) size) == 0))
+        {
+            ptr = mmap (NULL, size, (PROT_READ | PROT_WRITE), MAP_SHARED, fd, 0);
+        }
+
+        /* Mapping holds the object. */
+        if (fd >= 0)
+        {
+            (void) close (fd);
+        }
+
+        if (ptr != MAP_FAILED)
+        {
+            /* Lay out pool (mapping is page aligned). */
+            ret = memPoolShm_init ((uint8_t*) ptr, size, slotSize, slotNumber, ptr2Handle);
+
+            if (ret != MEM_POOL_OK)
+            {
+                (void) munmap (ptr, size);
+            }
+        }
+        else
+        {
+            /* Error! Object not created or mapped! */
+            ret = MEM_POOL_ERROR_SPACE;
+        }
+
+        /* Do not leave a half made object behind. */
+        if ((ret != MEM_POOL_OK) && (fd >= 0))
+        {
+            (void) shm_unlink (name);
+        }
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPoolShm_open (const char* name, memPoolShm_handle_t** ptr2Handle)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((name != NULL) && (ptr2Handle != NULL));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((name != NULL) && (ptr2Handle != NULL))
+    {
+        struct stat info;
+        void*       ptr;
+        int         fd;
+
+        ptr = MAP_FAILED;
+
+        /* Open object and map it whole. */
+        fd = shm_open (name, O_RDWR, 0);
+
+        if ((fd >= 0) && (fstat (fd, &info) == 0) && (info.st_size > 0))
+        {
+            ptr = mmap (NULL, (size_t) info.st_size, (PROT_READ | PROT_WRITE), MAP_SHARED, fd, 0);
+        }
+
+        /* Mapping holds the object. */
+        if (fd >= 0)
+        {
+            (void) close (fd);
+        }
+
+        if (ptr != MAP_FAILED)
+        {
+            /* Check pool. */
+            ret = memPoolShm_attach ((uint8_t*) ptr, (size_t) info.st_size, ptr2Handle);
+
+            if (ret != MEM_POOL_OK)
+            {
+                (void) munmap (ptr, (size_t) info.st_size);
+            }
+        }
+        else
+        {
+            /* Error! Object not opened or mapped! */
+            ret = MEM_POOL_ERROR_SPACE;
+        }
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPoolShm_close (memPoolShm_handle_t* ptrHandle)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert (ptrHandle != NULL);
+
+    /* Check parameters (if defined). */
+    memPool_checkParam (ptrHandle != NULL)
+    {
+        /* Unmap whole region (handle is its start). */
+        ret = (munmap (ptrHandle, (size_t) ptrHandle->regionSize) == 0) ? MEM_POOL_OK : MEM_POOL_ERROR_PARAMETERS;
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPoolShm_alloc (memPoolShm_handle_t* ptrHandle, uint8_t** ptr2Slot)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrHandle != NULL) && (ptr2Slot != NULL));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrHandle != NULL) && (ptr2Slot != NULL))
+    {
+        uint64_t head;
+        uint32_t top;
+        uint32_t idx;
+        bool     done;
+
+        head = atomic_load_explicit (&ptrHandle->head, memory_order_acquire);
+        done = false;
+        idx  = 0U;
+
+        /* Pop free list head (on failure head is reloaded). */
+        while ((done == false) && (memPoolShm_headIndex (head) != 0U))
+        {
+            /* Link may be stale if slot was popped meanwhile (tag makes the swap fail then). */
+            idx  = memPoolShm_headIndex (head) - 1U;
+            top  = (idx < ptrHandle->slotNumber) ?
+                   atomic_load_explicit (memPoolShm_link (ptrHandle, idx), memory_order_relaxed) : 0U;
+            done = atomic_compare_exchange_weak_explicit (&ptrHandle->head, &head,
+                                                          memPoolShm_headMake (memPoolShm_headTag (head) + 1U, top),
+                                                          memory_order_acquire, memory_order_acquire);
+        }
+
+        /* Free list empty: take slot from bump pointer. */
+        if (done == false)
+        {
+            idx = atomic_load_explicit (&ptrHandle->bumpIndex, memory_order_relaxed);
+
+            while ((done == false) && (idx < ptrHandle->slotNumber))
+            {
+                done = atomic_compare_exchange_weak_explicit (&ptrHandle->bumpIndex, &idx, (idx + 1U),
+                                                              memory_order_relaxed, memory_order_relaxed);
+            }
+        }
+
+        if (done == true)
+        {
+            /* Mark slot as allocated. */
+            (void) atomic_fetch_or_explicit (&memPoolShm_bitmap (ptrHandle)[memPool_bitmapWord (idx)],
+                                             memPool_bitmapMask (idx), memory_order_relaxed);
+
+            *ptr2Slot = memPoolShm_ptr (ptrHandle, idx);
+
+        #if (defined memPool_zeroize && (memPool_zeroize == 1))
+            /* Zeroise the slot (as calloc). */
+            (void) memset (*ptr2Slot, 0x00, ptrHandle->slotSize);
+        #else
+            /* Clear next. */
+            atomic_store_explicit (memPoolShm_link (ptrHandle, idx), 0U, memory_order_relaxed);
+        #endif /* memPool_zeroize && (memPool_zeroize == 1) */
+
+            /* Succeed! */
+            ret = MEM_POOL_OK;
+        }
+        else
+        {
+            /* Clear pointer. */
+            *ptr2Slot = NULL;
+
+            /* Error! No free slots! */
+            ret = MEM_POOL_ERROR_SPACE;
+        }
+    }
+
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPoolShm_free (memPoolShm_handle_t* ptrHandle, uint8_t* ptrSlot)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrHandle != NULL) && (ptrSlot != NULL));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrHandle != NULL) && (ptrSlot != NULL))
+    {
+        uint64_t head;
+        uint32_t idx;
+        uint32_t word;
+        bool     done;
+
+        /* Check that slot belongs to pool. */
+        ret = memPoolShm_slotIndex (ptrHandle, (uint64_t) (ptrSlot - ((uint8_t*) ptrHandle)), &idx);
+
+        if (ret == MEM_POOL_OK)
+        {
+            /* Mark slot as freed (atomically, so that only one free wins). */
+            word = atomic_fetch_and_explicit (&memPoolShm_bitmap (ptrHandle)[memPool_bitmapWord (idx)],
+                                              ~memPool_bitmapMask (idx), memory_order_relaxed);
+
+            /* Was not allocated? */
+            if ((word & memPool_bitmapMask (idx)) == 0U)
+            {
+                /* Error! Slot was not allocated! */
+                ret = MEM_POOL_ERROR_SLOT_NOT_ALLOCATED;
+            }
+        }
+
+        /* Succeed? */
+        if (ret == MEM_POOL_OK)
+        {
+            head = atomic_load_explicit (&ptrHandle->head, memory_order_relaxed);
+
+            /* Push slot on free list (on failure head is reloaded). */
+            do
+            {
+                atomic_store_explicit (memPoolShm_link (ptrHandle, idx), memPoolShm_headIndex (head),
+                                       memory_order_relaxed);
+
+                done = atomic_compare_exchange_weak_explicit (&ptrHandle->head, &head,
+                                                              memPoolShm_headMake (memPoolShm_headTag (head) + 1U,
+                                                                                   idx + 1U),
+                                                              memory_order_release, memory_order_relaxed);
+            } while (done == false);
+        }
+    }
+
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPoolShm_offset (const memPoolShm_handle_t* ptrHandle, const uint8_t* ptrSlot, uint64_t* ptrOffset)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrHandle != NULL) && (ptrSlot != NULL) && (ptrOffset != NULL));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrHandle != NULL) && (ptrSlot != NULL) && (ptrOffset != NULL))
+    {
+        uint32_t idx;
+
+        /* Offset from region start (handle), valid in any process. */
+        *ptrOffset = (uint64_t) (((uintptr_t) ptrSlot) - ((uintptr_t) ptrHandle));
+
+        /* Check that slot belongs to pool. */
+        ret = memPoolShm_slotIndex (ptrHandle, *ptrOffset, &idx);
+    }
+
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPoolShm_slot (memPoolShm_handle_t* ptrHandle, uint64_t offset, uint8_t** ptr2Slot)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrHandle != NULL) && (ptr2Slot != NULL));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrHandle != NULL) && (ptr2Slot != NULL))
+    {
+        uint32_t idx;
+
+        /* Check that offset is a slot of the pool. */
+        ret = memPoolShm_slotIndex (ptrHandle, offset, &idx);
+
+        /* Slot in this process mapping. */
+        *ptr2Slot = (ret == MEM_POOL_OK) ? memPoolShm_ptr (ptrHandle, idx) : NULL;
+    }
+
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+/* ************************************************************************** *
+ *                       End of global function section                       *
+ * ************************************************************************** */
+
+#endif /* defined MEM_POOL_SHM && (MEM_POOL_SHM == 1) */
@@ -0,0 +1,360 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2021 Alessandro Morniroli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file   memPoolSnapshot.c
+ * @author Alessandro Morniroli <alessandro.morniroli@gmail.com>
+ * @date   Sun Oct 18 2026
+ *
+ * @brief  Memory pool snapshot implementation.
+ */
+
+/* ************************************************************************** *
+ *                         Start of includes section                          *
+ * ************************************************************************** */
+
+/* Standard C. */
+#include <stddef.h>
+#include <string.h>
+/* Module include. */
+#include "memPool_priv.h"
+#include "memPoolSnapshot.h"
+
+/* ************************************************************************** *
+ *                          End of includes section                           *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                    Start of private definitions section                    *
+ * ************************************************************************** */
+
+/* ************************************************************************** *
+ *                     End of private definitions section                     *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                    Start of external variables section                     *
+ * ************************************************************************** */
+
+/* ************************************************************************** *
+ *                     End of external variables section                      *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                     Start of private variables section                     *
+ * ************************************************************************** */
+
+/* ************************************************************************** *
+ *                      End of private variables section                      *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                Start of private function prototypes section                *
+ * ************************************************************************** */
+
+static uint32_t
+memPoolSnapshot_toIndex (const memPool_handle_t* ptrHandle, const uint8_t* ptrSlot);
+
+static void
+memPoolSnapshot_saveList (const memPool_handle_t* ptrHandle, uint8_t* ptrHead);
+
+static memPool_error_t
+memPoolSnapshot_restoreList (const memPool_handle_t* ptrHandle, uint32_t link, uint8_t** ptr2Head, uint8_t** ptr2Tail);
+
+/* ************************************************************************** *
+ *                 End of private function prototypes section                 *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                     Start of private function section                      *
+ * ************************************************************************** */
+
+/**
+ * @brief Slot (or NULL) to position independent link: slot index + 1, or 0.
+ */
+static uint32_t
+memPoolSnapshot_toIndex (const memPool_handle_t* ptrHandle, const uint8_t* ptrSlot)
+{
+    /* Return the link. */
+    return (ptrSlot != NULL) ? ((uint32_t) ((uintptr_t) (ptrSlot - ptrHandle->ptrStorage) / ptrHandle->slotSize) + 1U) :
+                               0U;
+}
+
+/**
+ * @brief Rewrite links of a free list as slot indices.
+ */
+static void
+memPoolSnapshot_saveList (const memPool_handle_t* ptrHandle, uint8_t* ptrHead)
+{
+    uint8_t* ptrSlot;
+    uint8_t* ptrNext;
+
+    for (ptrSlot = ptrHead; ptrSlot != NULL; ptrSlot = ptrNext)
+    {
+        /* Next slot, then its index in place of the pointer. */
+        ptrNext                  = *((uint8_t**) ptrSlot);
+        *((uintptr_t*) ptrSlot) = (uintptr_t) memPoolSnapshot_toIndex (ptrHandle, ptrNext);
+    }
+}
+
+/**
+ * @brief Rewrite links of a free list (saved as slot indices) as pointers.
+ *
+ * Every link must be a slot handed out so far, and the list cannot be longer
+ * than the number of those slots (no loops).
+ *
+ * @return MEM_POOL_OK if list is consistent; MEM_POOL_ERROR_CORRUPTED
+ *         otherwise.
+ */
+static memPool_error_t
+memPoolSnapshot_restoreList (const memPool_handle_t* ptrHandle, uint32_t link, uint8_t** ptr2Head, uint8_t** ptr2Tail)
+{
+    memPool_error_t ret;
+    uint8_t**       ptr2Link;
+    uint8_t*        ptrSlot;
+    uint32_t        n;
+
+    /* Clear error code. */
+    ret      = MEM_POOL_OK;
+    ptr2Link = ptr2Head;
+    ptrSlot  = NULL;
+    n        = 0U;
+
+    while ((ret == MEM_POOL_OK) && (link != 0U))
+    {
+        /* Not a slot handed out, or loop? */
+        if ((link > ptrHandle->bumpIndex) || (n >= ptrHandle->bumpIndex))
+        {
+            /* Error! Snapshot is corrupted! */
+            ret = MEM_POOL_ERROR_CORRUPTED;
+        }
+        else
+        {
+            /* Link previous slot (or head), then follow saved index. */
+            ptrSlot   = &ptrHandle->ptrStorage[((link - 1U) * ptrHandle->slotSize)];
+            *ptr2Link = ptrSlot;
+            ptr2Link  = (uint8_t**) ptrSlot;
+            link      = (uint32_t) *((const uintptr_t*) ptrSlot);
+            n++;
+        }
+    }
+
+    /* Terminate list, store its last slot (if requested). */
+    *ptr2Link = NULL;
+
+    if (ptr2Tail != NULL)
+    {
+        *ptr2Tail = ptrSlot;
+    }
+
+    /* Return the function result code. */
+    return ret;
+}
+
+/* ************************************************************************** *
+ *                      End of private function section                       *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                      Start of global function section                      *
+ * ************************************************************************** */
+
+memPool_error_t
+memPoolSnapshot_save (memPool_handle_t* ptrHandle, memPoolSnapshot_t* ptrSnapshot)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrHandle != NULL) && (ptrSnapshot != NULL));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrHandle != NULL) && (ptrSnapshot != NULL))
+    {
+        /* Clear snapshot (unused fields are zero). */
+        (void) memset (ptrSnapshot, 0x00, sizeof (*ptrSnapshot));
+
+        /* Pool state. */
+        ptrSnapshot->magic      = MEM_POOL_SNAPSHOT_MAGIC;
+        ptrSnapshot->flags      = ((ptrHandle->ptrBitmap != NULL) ? MEM_POOL_SNAPSHOT_BITMAP : 0U) |
+                                  ((ptrHandle->ptrIndex  != NULL) ? MEM_POOL_SNAPSHOT_INDEX  : 0U) |
+                                  ((ptrHandle->ptrGen    != NULL) ? MEM_POOL_SNAPSHOT_GEN    : 0U);
+        ptrSnapshot->slotSize   = ptrHandle->slotSize;
+        ptrSnapshot->slotNumber = ptrHandle->slotNumber;
+        ptrSnapshot->bumpIndex  = ptrHandle->bumpIndex;
+        ptrSnapshot->bumpHigh   = ptrHandle->bumpHigh;
+        ptrSnapshot->indexTop   = ptrHandle->indexTop;
+        ptrSnapshot->head       = memPoolSnapshot_toIndex (ptrHandle, ptrHandle->ptrHead);
+    #if (defined memPool_zeroize && (memPool_zeroize == 1))
+        ptrSnapshot->dirty      = memPoolSnapshot_toIndex (ptrHandle, ptrHandle->ptrDirty);
+        ptrSnapshot->zeroPolicy = (uint32_t) ptrHandle->zeroPolicy;
+        ptrSnapshot->zeroBytes  = ptrHandle->zeroBytes;
+    #endif /* memPool_zeroize && (memPool_zeroize == 1) */
+    #if (defined MEM_POOL_FREE_ORDER && (MEM_POOL_FREE_ORDER == 1))
+        ptrSnapshot->order      = (uint32_t) ptrHandle->order;
+    #endif /* MEM_POOL_FREE_ORDER && (MEM_POOL_FREE_ORDER == 1) */
+    #if (defined MEM_POOL_DEBUG && (MEM_POOL_DEBUG == 1))
+        ptrSnapshot->debugFlags  = ptrHandle->debugFlags;
+        ptrSnapshot->corruptions = ptrHandle->corruptions;
+    #endif /* MEM_POOL_DEBUG && (MEM_POOL_DEBUG == 1) */
+    #if (defined MEM_POOL_STATS && (MEM_POOL_STATS == 1))
+        ptrSnapshot->stats      = ptrHandle->stats;
+    #endif /* MEM_POOL_STATS && (MEM_POOL_STATS == 1) */
+
+        /* Links as slot indices (storage is position independent). */
+        memPoolSnapshot_saveList (ptrHandle, ptrHandle->ptrHead);
+    #if (defined memPool_zeroize && (memPool_zeroize == 1))
+        memPoolSnapshot_saveList (ptrHandle, ptrHandle->ptrDirty);
+    #endif /* memPool_zeroize && (memPool_zeroize == 1) */
+
+        /* Succeed! */
+        ret = MEM_POOL_OK;
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPoolSnapshot_restore (memPool_handle_t*        ptrHandle,
+                         const memPoolSnapshot_t* ptrSnapshot,
+                         uint8_t*                 ptrStorage,
+                         uint32_t*                ptrBitmap,
+                         memPool_index_t*         ptrIndex,
+                         uint32_t*                ptrGen)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert ((ptrHandle   != NULL) &&
+                    (ptrSnapshot != NULL) &&
+                    (ptrStorage  != NULL) &&
+                    (((ptrSnapshot->flags & MEM_POOL_SNAPSHOT_BITMAP) != 0U) == (ptrBitmap != NULL)) &&
+                    (((ptrSnapshot->flags & MEM_POOL_SNAPSHOT_INDEX)  != 0U) == (ptrIndex  != NULL)) &&
+                    (((ptrSnapshot->flags & MEM_POOL_SNAPSHOT_GEN)    != 0U) == (ptrGen    != NULL)));
+
+    /* Check parameters (if defined). */
+    memPool_checkParam ((ptrHandle   != NULL) &&
+                        (ptrSnapshot != NULL) &&
+                        (ptrStorage  != NULL) &&
+                        (((ptrSnapshot->flags & MEM_POOL_SNAPSHOT_BITMAP) != 0U) == (ptrBitmap != NULL)) &&
+                        (((ptrSnapshot->flags & MEM_POOL_SNAPSHOT_INDEX)  != 0U) == (ptrIndex  != NULL)) &&
+                        (((ptrSnapshot->flags & MEM_POOL_SNAPSHOT_GEN)    != 0U) == (ptrGen    != NULL)))
+    {
+        memPool_handle_t pool;
+        uint32_t         k;
+
+        /* Not a snapshot, or not consistent? */
+        if ((ptrSnapshot->magic      != MEM_POOL_SNAPSHOT_MAGIC)                                    ||
+            (ptrSnapshot->slotSize   <  ((ptrIndex != NULL) ? 1U : (uint32_t) sizeof (uint8_t*)))   ||
+            (ptrSnapshot->bumpIndex  >  ptrSnapshot->slotNumber)                                    ||
+            (ptrSnapshot->bumpHigh   >  ptrSnapshot->slotNumber)                                    ||
+            (ptrSnapshot->indexTop   >  ptrSnapshot->bumpIndex)                                     ||
+            (ptrSnapshot->zeroPolicy >  (uint32_t) MEM_POOL_ZERO_PARTIAL)                           ||
+            (ptrSnapshot->order      >  (uint32_t) MEM_POOL_ORDER_FIFO))
+        {
+            /* Error! Snapshot is corrupted! */
+            ret = MEM_POOL_ERROR_CORRUPTED;
+        }
+        else
+        {
+            /* Pool state (built aside: handle untouched on error). */
+            (void) memset (&pool, 0x00, sizeof (pool));
+            pool.ptrStorage = ptrStorage;
+            pool.ptrBitmap  = ptrBitmap;
+            pool.ptrIndex   = ptrIndex;
+            pool.indexTop   = ptrSnapshot->indexTop;
+            pool.ptrGen     = ptrGen;
+            pool.slotSize   = ptrSnapshot->slotSize;
+            pool.slotNumber = ptrSnapshot->slotNumber;
+            pool.bumpIndex  = ptrSnapshot->bumpIndex;
+            pool.bumpHigh   = ptrSnapshot->bumpHigh;
+        #if (defined memPool_zeroize && (memPool_zeroize == 1))
+            pool.zeroPolicy = (memPool_zeroPolicy_t) ptrSnapshot->zeroPolicy;
+            pool.zeroBytes  = ptrSnapshot->zeroBytes;
+        #endif /* memPool_zeroize && (memPool_zeroize == 1) */
+        #if (defined MEM_POOL_FREE_ORDER && (MEM_POOL_FREE_ORDER == 1))
+            pool.order      = (memPool_order_t) ptrSnapshot->order;
+        #endif /* MEM_POOL_FREE_ORDER && (MEM_POOL_FREE_ORDER == 1) */
+        #if (defined MEM_POOL_DEBUG && (MEM_POOL_DEBUG == 1))
+            pool.debugFlags  = ptrSnapshot->debugFlags;
+            pool.corruptions = ptrSnapshot->corruptions;
+        #endif /* MEM_POOL_DEBUG && (MEM_POOL_DEBUG == 1) */
+        #if (defined MEM_POOL_STATS && (MEM_POOL_STATS == 1))
+            pool.stats      = ptrSnapshot->stats;
+        #endif /* MEM_POOL_STATS && (MEM_POOL_STATS == 1) */
+
+            /* Out-of-band free list entries are slots handed out? */
+            ret = MEM_POOL_OK;
+
+            for (k = 0U; k < pool.indexTop; k++)
+            {
+                if (((uint32_t) ptrIndex[k]) >= pool.bumpIndex)
+                {
+                    /* Error! Snapshot is corrupted! */
+                    ret = MEM_POOL_ERROR_CORRUPTED;
+                }
+            }
+
+            /* Links back to pointers (FIFO tail is the last slot of the list). */
+            if (ret == MEM_POOL_OK)
+            {
+            #if (defined MEM_POOL_FREE_ORDER && (MEM_POOL_FREE_ORDER == 1))
+                ret = memPoolSnapshot_restoreList (&pool, ptrSnapshot->head, &pool.ptrHead, &pool.ptrTail);
+            #else
+                ret = memPoolSnapshot_restoreList (&pool, ptrSnapshot->head, &pool.ptrHead, NULL);
+            #endif /* MEM_POOL_FREE_ORDER && (MEM_POOL_FREE_ORDER == 1) */
+            }
+
+        #if (defined memPool_zeroize && (memPool_zeroize == 1))
+            if (ret == MEM_POOL_OK)
+            {
+                ret = memPoolSnapshot_restoreList (&pool, ptrSnapshot->dirty, &pool.ptrDirty, NULL);
+            }
+        #endif /* memPool_zeroize && (memPool_zeroize == 1) */
+
+            /* Succeed? Pool is ready. */
+            if (ret == MEM_POOL_OK)
+            {
+                *ptrHandle = pool;
+            }
+        }
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+/* ************************************************************************** *
+ *                       End of global function section                       *
+ * ************************************************************************** */
@@ -0,0 +1,370 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2021 Alessandro Morniroli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file   memPoolTrace.c
+ * @author Alessandro Morniroli <alessandro.morniroli@gmail.com>
+ * @date   Sun Oct 18 2026
+ *
+ * @brief  Memory pool allocation tracing implementation.
+ */
+
+/* ************************************************************************** *
+ *                         Start of includes section                          *
+ * ************************************************************************** */
+
+/* Standard C. */
+#include <stdatomic.h>
+#include <stddef.h>
+#include <string.h>
+#include <time.h>
+#if (defined __x86_64__ || defined __i386__)
+    /* Time stamp counter. */
+    #include <x86intrin.h>
+#endif /* __x86_64__ || __i386__ */
+/* Module include. */
+#include "memPool_priv.h"
+#include "memPoolMt.h"
+#include "memPoolTrace.h"
+
+/* ************************************************************************** *
+ *                          End of includes section                           *
+ * ************************************************************************** */
+
+#if (defined MEM_POOL_TRACE && (MEM_POOL_TRACE == 1))
+
+
+/* ************************************************************************** *
+ *                    Start of private definitions section                    *
+ * ************************************************************************** */
+
+/**
+ * Events copied out of a ring at once (while draining).
+ */
+#define MEM_POOL_TRACE_CHUNK 64U
+
+/**
+ * Oldest event position still intact once \p head events were recorded: the
+ * owner may be overwriting the one before (position head - EVENTS) already.
+ */
+#define memPoolTrace_oldest(head) \
+    (((head) >= MEM_POOL_TRACE_EVENTS) ? (((head) + 1U) - MEM_POOL_TRACE_EVENTS) : 0U)
+
+/**
+ * Timestamp clock.
+ */
+#if (defined __x86_64__ || defined __i386__ || defined __aarch64__)
+    #define MEM_POOL_TRACE_CLOCK MEM_POOL_TRACE_CLOCK_TSC
+#else
+    #define MEM_POOL_TRACE_CLOCK MEM_POOL_TRACE_CLOCK_NS
+#endif
+
+/**
+ * Per-thread event ring: head is written by owner thread only, tail by
+ * drainer only (different cache lines).
+ */
+typedef struct
+{
+    _Alignas (MEM_POOL_CACHE_LINE) _Atomic uint64_t head;  /**< Events recorded.   */
+    _Alignas (MEM_POOL_CACHE_LINE) uint64_t         tail;  /**< Events drained.    */
+    memPoolTrace_event_t events[MEM_POOL_TRACE_EVENTS];    /**< Events (circular). */
+} memPoolTrace_ring_t;
+
+/* ************************************************************************** *
+ *                     End of private definitions section                     *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                    Start of external variables section                     *
+ * ************************************************************************** */
+
+/* ************************************************************************** *
+ *                     End of external variables section                      *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                     Start of private variables section                     *
+ * ************************************************************************** */
+
+/**
+ * Rings, number of rings claimed and events of threads with no ring.
+ */
+static memPoolTrace_ring_t memPoolTrace_rings[MEM_POOL_TRACE_THREADS];
+static _Atomic uint32_t    memPoolTrace_claimed;
+static _Atomic uint64_t    memPoolTrace_unclaimed;
+
+/**
+ * Ring of the calling thread (NULL if not claimed yet) and whether none was
+ * left for it (no further claim).
+ */
+static _Thread_local memPoolTrace_ring_t* memPoolTrace_threadRing;
+static _Thread_local bool                 memPoolTrace_threadNoRing;
+
+/* ************************************************************************** *
+ *                      End of private variables section                      *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                Start of private function prototypes section                *
+ * ************************************************************************** */
+
+static uint64_t
+memPoolTrace_now (void);
+
+static memPoolTrace_ring_t*
+memPoolTrace_claim (void);
+
+/* ************************************************************************** *
+ *                 End of private function prototypes section                 *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                     Start of private function section                      *
+ * ************************************************************************** */
+
+/**
+ * @brief Get timestamp (see \ref MEM_POOL_TRACE_CLOCK).
+ */
+static uint64_t
+memPoolTrace_now (void)
+{
+    uint64_t now;
+
+#if (defined __x86_64__ || defined __i386__)
+    /* Time stamp counter (not serializing). */
+    now = __rdtsc ();
+#elif (defined __aarch64__)
+    /* Virtual counter. */
+    __asm__ volatile ("mrs %0, cntvct_el0" : "=r" (now));
+#else
+    struct timespec ts;
+
+    /* Wall clock. */
+    (void) timespec_get (&ts, TIME_UTC);
+    now = (((uint64_t) ts.tv_sec) * 1000000000U) + ((uint64_t) ts.tv_nsec);
+#endif
+
+    /* Return the timestamp. */
+    return now;
+}
+
+/**
+ * @brief Claim a ring for the calling thread (first event).
+ *
+ * @return Ring claimed, NULL if none left.
+ */
+static memPoolTrace_ring_t*
+memPoolTrace_claim (void)
+{
+    uint32_t number;
+
+    number = atomic_load_explicit (&memPoolTrace_claimed, memory_order_relaxed);
+
+    /* Next ring (never given back): counter never exceeds number of rings, as drain reads it. */
+    while ((number < MEM_POOL_TRACE_THREADS) &&
+           (atomic_compare_exchange_weak_explicit (&memPoolTrace_claimed, &number, (number + 1U),
+                                                   memory_order_relaxed, memory_order_relaxed) == false))
+    {
+    }
+
+    if (number < MEM_POOL_TRACE_THREADS)
+    {
+        memPoolTrace_threadRing = &memPoolTrace_rings[number];
+    }
+    else
+    {
+        /* None left: do not try again. */
+        memPoolTrace_threadNoRing = true;
+    }
+
+    /* Return the ring claimed. */
+    return memPoolTrace_threadRing;
+}
+
+/* ************************************************************************** *
+ *                      End of private function section                       *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                      Start of global function section                      *
+ * ************************************************************************** */
+
+void
+memPoolTrace_record (uint32_t type, const void* ptrPool, uint32_t slot, const void* ptrCaller)
+{
+    memPoolTrace_ring_t*  ptrRing;
+    memPoolTrace_event_t* ptrEvent;
+    uint64_t              head;
+
+    /* First event from this thread (and rings left)? */
+    ptrRing = memPoolTrace_threadRing;
+
+    if ((ptrRing == NULL) && (memPoolTrace_threadNoRing == false))
+    {
+        ptrRing = memPoolTrace_claim ();
+    }
+
+    if (ptrRing != NULL)
+    {
+        /* Fill next event (oldest one if full), then publish it. */
+        head     = atomic_load_explicit (&ptrRing->head, memory_order_relaxed);
+        ptrEvent = &ptrRing->events[head & (MEM_POOL_TRACE_EVENTS - 1U)];
+
+        ptrEvent->timestamp = memPoolTrace_now ();
+        ptrEvent->pool      = (uint64_t) (uintptr_t) ptrPool;
+        ptrEvent->caller    = (uint64_t) (uintptr_t) ptrCaller;
+        ptrEvent->slot      = slot;
+        ptrEvent->type      = (uint16_t) type;
+        ptrEvent->thread    = (uint16_t) (ptrRing - memPoolTrace_rings);
+
+        atomic_store_explicit (&ptrRing->head, (head + 1U), memory_order_release);
+    }
+    else
+    {
+        /* No ring: event dropped. */
+        (void) atomic_fetch_add_explicit (&memPoolTrace_unclaimed, 1U, memory_order_relaxed);
+    }
+}
+
+memPool_error_t
+memPoolTrace_drain (memPoolTrace_sink_t sink, void* ptrContext, uint64_t* ptrDropped)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert (sink != NULL);
+
+    /* Check parameters (if defined). */
+    memPool_checkParam (sink != NULL)
+    {
+        memPoolTrace_event_t chunk[MEM_POOL_TRACE_CHUNK];
+        memPoolTrace_ring_t* ptrRing;
+        uint64_t             dropped;
+        uint64_t             head;
+        uint64_t             oldest;
+        uint64_t             lost;
+        uint32_t             number;
+        uint32_t             count;
+        uint32_t             i;
+        uint32_t             j;
+
+        /* Threads with no ring. */
+        dropped = atomic_exchange_explicit (&memPoolTrace_unclaimed, 0U, memory_order_relaxed);
+        number  = atomic_load_explicit (&memPoolTrace_claimed, memory_order_acquire);
+
+        for (i = 0U; i < number; i++)
+        {
+            ptrRing = &memPoolTrace_rings[i];
+            head    = atomic_load_explicit (&ptrRing->head, memory_order_acquire);
+
+            while (ptrRing->tail != head)
+            {
+                /* Events older than one lap were overwritten (or are being so). */
+                oldest = memPoolTrace_oldest (head);
+
+                if (ptrRing->tail < oldest)
+                {
+                    dropped       += oldest - ptrRing->tail;
+                    ptrRing->tail  = oldest;
+                }
+
+                /* Copy a chunk out. */
+                count = ((head - ptrRing->tail) < MEM_POOL_TRACE_CHUNK) ? ((uint32_t) (head - ptrRing->tail)) :
+                                                                          MEM_POOL_TRACE_CHUNK;
+
+                for (j = 0U; j < count; j++)
+                {
+                    chunk[j] = ptrRing->events[(ptrRing->tail + j) & (MEM_POOL_TRACE_EVENTS - 1U)];
+                }
+
+                /* Events overwritten while copied (owner lapped the drainer, torn event included) are skipped. */
+                atomic_thread_fence (memory_order_acquire);
+                head   = atomic_load_explicit (&ptrRing->head, memory_order_relaxed);
+                oldest = memPoolTrace_oldest (head);
+                lost   = (ptrRing->tail < oldest) ? (oldest - ptrRing->tail) : 0U;
+                lost   = (lost < count) ? lost : count;
+
+                if (lost != count)
+                {
+                    sink (ptrContext, &chunk[lost], (count - (uint32_t) lost));
+                }
+
+                dropped       += lost;
+                ptrRing->tail += count;
+            }
+        }
+
+        /* Store number of events dropped. */
+        if (ptrDropped != NULL)
+        {
+            *ptrDropped = dropped;
+        }
+
+        /* Succeed! */
+        ret = MEM_POOL_OK;
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+memPool_error_t
+memPoolTrace_fileHeader (memPoolTrace_fileHeader_t* ptrHeader)
+{
+    memPool_error_t ret;
+
+    /* Assert block (if defined). */
+    memPool_assert (ptrHeader != NULL);
+
+    /* Check parameters (if defined). */
+    memPool_checkParam (ptrHeader != NULL)
+    {
+        /* Format and timestamp clock of this build. */
+        ptrHeader->magic     = MEM_POOL_TRACE_MAGIC;
+        ptrHeader->eventSize = (uint32_t) sizeof (memPoolTrace_event_t);
+        ptrHeader->clock     = MEM_POOL_TRACE_CLOCK;
+        ptrHeader->reserved  = 0U;
+
+        /* Succeed! */
+        ret = MEM_POOL_OK;
+    }
+
+    /* Assert block (if defined). */
+    memPool_assert (ret == MEM_POOL_OK);
+
+    /* Return the function result code. */
+    return ret;
+}
+
+/* ************************************************************************** *
+ *                       End of global function section                       *
+ * ************************************************************************** */
+
+#endif /* defined MEM_POOL_TRACE && (MEM_POOL_TRACE == 1) */
@@ -0,0 +1,155 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2021 Alessandro Morniroli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file   memPool_priv.h
+ * @author Alessandro Morniroli <alessandro.morniroli@gmail.com>
+ * @date   Sun Oct 18 2026
+ *
+ * @brief  Static memory pool private definitions (shared by pool modules).
+ */
+
+/* ************************************************************************** */
+#ifndef MEM_POOL_PRIV_H__
+#define MEM_POOL_PRIV_H__
+/* ************************************************************************** */
+
+/* ************************************************************************** *
+ *                         Start of includes section                          *
+ * ************************************************************************** */
+
+/* Standard C. */
+#include <stdbool.h>
+#include <stdint.h>
+/* Module include. */
+#include "memPool_conf.h"
+#include "memPool.h"
+
+/* ************************************************************************** *
+ *                          End of includes section                           *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                    Start of private definitions section                    *
+ * ************************************************************************** */
+
+/**
+ * Check parameters macro.
+ */
+#if (!defined MEM_POOL_CHECK_PARAMS || (MEM_POOL_CHECK_PARAMS == 0))
+    #define memPool_checkParam(...)
+#else
+    #define memPool_checkParam(pX)           \
+        if ((pX) == false)                   \
+        {                                    \
+            ret = MEM_POOL_ERROR_PARAMETERS; \
+        }                                    \
+        else
+#endif /* MEM_POOL_CHECK_PARAMS && (MEM_POOL_CHECK_PARAMS == 1) */
+
+/**
+ * Allocation bitmap word index / bit mask of a slot.
+ */
+#define memPool_bitmapWord(idx) ((idx) >> 5U)
+#define memPool_bitmapMask(idx) (((uint32_t) 1U) << ((idx) & 31U))
+
+/**
+ * Index of lowest bit set of a (not zero) bitmap word.
+ */
+#if (defined __GNUC__)
+    #define memPool_bitmapLowest(word) ((uint32_t) __builtin_ctz (word))
+#else
+    #define memPool_bitmapLowest(word) memPool_ctz (word)
+#endif /* __GNUC__ */
+
+/**
+ * Statistics update macros (nothing if statistics are disabled).
+ */
+#if (defined MEM_POOL_STATS && (MEM_POOL_STATS == 1))
+    #define memPool_statsAdd(pStats, field, n) ((pStats)->field += (n))
+    #define memPool_statsSub(pStats, field, n) ((pStats)->field -= (n))
+#else
+    #define memPool_statsAdd(pStats, field, n)
+    #define memPool_statsSub(pStats, field, n)
+#endif /* MEM_POOL_STATS && (MEM_POOL_STATS == 1) */
+
+/**
+ * Caller of the running routine (tracing only). Wrappers pass it down to
+ * \ref memPool_allocFrom / \ref memPool_freeFrom, so traced events point at
+ * user code rather than at the wrapper.
+ */
+#if (defined MEM_POOL_TRACE && (MEM_POOL_TRACE == 1) && defined __GNUC__)
+    #define memPool_caller() __builtin_return_address (0)
+#else
+    #define memPool_caller() NULL
+#endif /* MEM_POOL_TRACE && (MEM_POOL_TRACE == 1) && __GNUC__ */
+
+/* ************************************************************************** *
+ *                     End of private definitions section                     *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                     Start of private function section                      *
+ * ************************************************************************** */
+
+#if (!defined __GNUC__)
+/**
+ * @brief Count trailing zeros of a (not zero) word (portable).
+ */
+static inline uint32_t
+memPool_ctz (uint32_t word)
+{
+    uint32_t n;
+
+    /* Skip zero bits from the lowest one. */
+    for (n = 0U; ((word >> n) & 1U) == 0U; n++)
+    {
+    }
+
+    /* Return number of zero bits. */
+    return n;
+}
+#endif /* !__GNUC__ */
+
+/**
+ * @brief mempool alloc on behalf of \p ptrCaller (traced as its caller).
+ *
+ * Same as \ref memPool_tryAlloc: an exhausted pool is expected by the caller.
+ */
+memPool_error_t
+memPool_allocFrom (memPool_handle_t* ptrHandle, uint8_t** ptr2Slot, const void* ptrCaller);
+
+/**
+ * @brief mempool free on behalf of \p ptrCaller (traced as its caller).
+ */
+memPool_error_t
+memPool_freeFrom (memPool_handle_t* ptrHandle, uint8_t* ptrSlot, const void* ptrCaller);
+
+/* ************************************************************************** *
+ *                      End of private function section                       *
+ * ************************************************************************** */
+
+/* ************************************************************************** */
+#endif /* MEM_POOL_PRIV_H__ */
+/* ************************************************************************** */
@@ -0,0 +1,164 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2021 Alessandro Morniroli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file   memPool_ConfTemplate.h
+ * @author Alessandro Morniroli <alessandro.morniroli@gmail.com>
+ * @date   Thu Nov 16 2023
+ *
+ * @brief  Memory pool configuration template.
+ */
+
+#ifndef MEM_POOL_CONF_TEMPLATE_H__
+#define MEM_POOL_CONF_TEMPLATE_H__
+
+/**********************************************************************************************************************
+*           HEADER INCLUDE                                                                                            *
+**********************************************************************************************************************/
+
+/* Standard C. */
+#include <assert.h>
+
+/**
+ * If enabled, parameters function are checked (if not valid, \ref MEM_POOL_ERROR_PARAMETERS is returned)
+ */
+#define MEM_POOL_CHECK_PARAMS 1
+
+/**
+ * Assert function to use (#define memPool_assert(...) if not needed).
+ */
+#define memPool_assert(pX) assert ((pX))
+
+/**
+ * Slot is 'zeroize' (as calloc standard routine) when \ref memPool_get allocates a valid one.
+ */
+#define memPool_zeroize 1
+
+/**
+ * If enabled, \ref memPool_free walks the whole free list (O(n)) to detect a slot that was not allocated when the pool
+ * has no allocation bitmap (legacy mode). Pools initialized through \ref memPool_initBitmap always use the bitmap (O(1)).
+ */
+#define MEM_POOL_LEGACY_FREE_CHECK 0
+
+/**
+ * If enabled, pools keep statistics (slots in use, high water mark, allocs, frees and failures), see
+ * \ref memPool_getStats. No code nor memory is spent on statistics when disabled.
+ */
+#define MEM_POOL_STATS 0
+
+/**
+ * Number of per-thread counter shards of lock-free pools statistics (threads update different cache lines).
+ */
+#define MEM_POOL_STATS_SHARDS 8U
+
+/**
+ * Number of slots cached by each per-thread magazine (see memPoolMag.h); 0 to disable magazines. Magazines are refilled
+ * and flushed by half of this size.
+ */
+#define MEM_POOL_MAGAZINE_SIZE 0U
+
+/**
+ * Maximum number of size classes of a pool set (see memPoolSet.h); 0 to disable pool sets.
+ */
+#define MEM_POOL_SET_CLASSES 0U
+
+/**
+ * Largest slot size (bytes) of a pool set class (sizes the class lookup table).
+ */
+#define MEM_POOL_SET_MAX_SLOT_SIZE 256U
+
+/**
+ * Maximum number of NUMA nodes of an mmap backed node set (see memPoolMap.h, Linux only); 0 to disable mmap backend.
+ */
+#define MEM_POOL_MAP_NODES 0U
+
+/**
+ * Slots of at least this size (bytes) are cleared by \ref memPool_zeroDirty with non-temporal (cache bypassing) SIMD
+ * stores, where supported (SSE2); 0 to always use memset.
+ */
+#define MEM_POOL_ZERO_STREAM_MIN 1024U
+
+/**
+ * Width (16 or 32 bits) of the slot indices of out-of-band free lists (see \ref memPool_initIndex): 16-bit indices
+ * halve the metadata of pools up to 65536 slots.
+ */
+#define MEM_POOL_INDEX_BITS 32U
+
+/**
+ * Width (32 or 64 bits) of slot handles (see \ref memPool_allocHandle) and number of their bits holding the slot index
+ * (the others hold the generation, which detects stale handles).
+ */
+#define MEM_POOL_HANDLE_BITS       32U
+#define MEM_POOL_HANDLE_INDEX_BITS 20U
+
+/**
+ * Debug mode: freed slots are checked to be inside the pool and on a slot boundary in O(1) (even with no bitmap),
+ * and pools may enable poison patterns and canaries (see memPool_setDebug), with AddressSanitizer poisoning.
+ */
+#define MEM_POOL_DEBUG 0U
+
+/**
+ * If enabled, pools may keep their free list in address order (live slots dense at the low end of storage) or FIFO
+ * order instead of LIFO (see memPool_setOrder).
+ */
+#define MEM_POOL_FREE_ORDER 0U
+
+/**
+ * If enabled, inline pools (see memPoolInline.h) check freed slots (range and slot boundary, O(1)).
+ */
+#define MEM_POOL_INLINE_CHECKS 1
+
+/**
+ * If enabled, pools may live in a POSIX shared memory region and be shared across processes (see memPoolShm.h).
+ */
+#define MEM_POOL_SHM 0U
+
+/**
+ * If enabled, memPool_alloc / memPool_free record trace events (pool, slot index, caller, timestamp) into per-thread
+ * rings (see memPoolTrace.h).
+ */
+#define MEM_POOL_TRACE 0U
+
+/**
+ * Trace events kept by each thread ring (power of two, oldest overwritten) and number of rings (threads tracing).
+ */
+#define MEM_POOL_TRACE_EVENTS  4096U
+#define MEM_POOL_TRACE_THREADS 8U
+
+/**********************************************************************************************************************
+*           PUBLIC DEFINES                                                                                            *
+**********************************************************************************************************************/
+
+/**********************************************************************************************************************
+*           PUBLIC TYPES                                                                                              *
+**********************************************************************************************************************/
+
+/**********************************************************************************************************************
+*           PUBLIC VARIABLES                                                                                          *
+**********************************************************************************************************************/
+
+/**********************************************************************************************************************
+*           PUBLIC FUNCTIONS PROTOTYPES                                                                               *
+**********************************************************************************************************************/
+
+#endif /* MEM_POOL_CONF_TEMPLATE_H__ */
+
@@ -0,0 +1,666 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2021 Alessandro Morniroli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file   memPoolTraceDecode.c
+ * @author Alessandro Morniroli <alessandro.morniroli@gmail.com>
+ * @date   Sun Oct 18 2026
+ *
+ * @brief  Offline trace log decoder (see memPoolTrace.h and "make tracedecode").
+ *
+ * Events of all threads are merged in timestamp order, allocations are paired
+ * with frees by pool and slot index: per callsite (allocation caller return
+ * address, see addr2line) allocs, frees and slots still live at log end are
+ * printed, then lifetime histograms (log2 buckets of timestamp ticks), CSV.
+ */
+
+/* ************************************************************************** *
+ *                         Start of includes section                          *
+ * ************************************************************************** */
+
+/* Standard C. */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+/* Module include. */
+#include "memPoolTrace.h"
+
+/* ************************************************************************** *
+ *                          End of includes section                           *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                    Start of private definitions section                    *
+ * ************************************************************************** */
+
+/**
+ * Lifetime histogram buckets (log2 of timestamp ticks).
+ */
+#define MEM_POOL_TRACE_DECODE_BUCKETS 64U
+
+/**
+ * Live slot table entry states (open addressing: freed entries are kept as
+ * tombstones, so that probe chains are not broken).
+ */
+#define MEM_POOL_TRACE_DECODE_EMPTY 0U
+#define MEM_POOL_TRACE_DECODE_USED  1U
+#define MEM_POOL_TRACE_DECODE_GONE  2U
+
+/**
+ * Event read from the log, with its position (merge is stable).
+ */
+typedef struct
+{
+    memPoolTrace_event_t event;    /**< Event.                  */
+    uint64_t             sequence; /**< Position in the log.    */
+} memPoolTraceDecode_entry_t;
+
+/**
+ * Allocation callsite.
+ */
+typedef struct
+{
+    uint64_t caller;                                   /**< Caller return address.         */
+    uint64_t allocs;                                   /**< Allocations.                   */
+    uint64_t frees;                                    /**< Frees of its allocations.      */
+    uint64_t live;                                     /**< Allocations still live.        */
+    uint64_t lifetimes[MEM_POOL_TRACE_DECODE_BUCKETS]; /**< Lifetime histogram.            */
+} memPoolTraceDecode_site_t;
+
+/**
+ * Live slot (allocated, not freed yet).
+ */
+typedef struct
+{
+    uint64_t pool;      /**< Pool.                            */
+    uint32_t slot;      /**< Slot index.                      */
+    uint32_t state;     /**< Entry state.                     */
+    uint32_t site;      /**< Allocation callsite.             */
+    uint64_t timestamp; /**< Allocation timestamp.            */
+} memPoolTraceDecode_live_t;
+
+/* ************************************************************************** *
+ *                     End of private definitions section                     *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                     Start of private variables section                     *
+ * ************************************************************************** */
+
+/**
+ * Callsites, and their hash table by caller (site index plus one, 0 if empty).
+ */
+static memPoolTraceDecode_site_t* memPoolTraceDecode_sites;
+static uint32_t                   memPoolTraceDecode_siteCount;
+static uint32_t                   memPoolTraceDecode_siteCapacity;
+static uint32_t*                  memPoolTraceDecode_siteTable;
+
+/**
+ * Live slots hash table by (pool, slot) and entries taken (used or gone).
+ */
+static memPoolTraceDecode_live_t* memPoolTraceDecode_live;
+static uint64_t                   memPoolTraceDecode_liveCapacity;
+static uint64_t                   memPoolTraceDecode_liveTaken;
+
+/* ************************************************************************** *
+ *                      End of private variables section                      *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                Start of private function prototypes section                *
+ * ************************************************************************** */
+
+static int
+memPoolTraceDecode_compare (const void* ptrA, const void* ptrB);
+
+static uint64_t
+memPoolTraceDecode_hash (uint64_t pool, uint32_t slot);
+
+static bool
+memPoolTraceDecode_siteGrow (void);
+
+static bool
+memPoolTraceDecode_site (uint64_t caller, uint32_t* ptrSite);
+
+static memPoolTraceDecode_live_t*
+memPoolTraceDecode_find (uint64_t pool, uint32_t slot, bool insert);
+
+static bool
+memPoolTraceDecode_liveGrow (void);
+
+static uint32_t
+memPoolTraceDecode_bucket (uint64_t ticks);
+
+static bool
+memPoolTraceDecode_load (FILE* ptrFile, memPoolTraceDecode_entry_t** ptr2Entries, uint64_t* ptrCount);
+
+static bool
+memPoolTraceDecode_pair (const memPoolTraceDecode_entry_t* ptrEntries, uint64_t count, uint64_t* ptrUnmatched);
+
+static void
+memPoolTraceDecode_print (void);
+
+/* ************************************************************************** *
+ *                 End of private function prototypes section                 *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                     Start of private function section                      *
+ * ************************************************************************** */
+
+/**
+ * @brief Compare events: timestamp order, log order among equal timestamps.
+ */
+static int
+memPoolTraceDecode_compare (const void* ptrA, const void* ptrB)
+{
+    const memPoolTraceDecode_entry_t* a = (const memPoolTraceDecode_entry_t*) ptrA;
+    const memPoolTraceDecode_entry_t* b = (const memPoolTraceDecode_entry_t*) ptrB;
+    int                               order;
+
+    if (a->event.timestamp != b->event.timestamp)
+    {
+        order = (a->event.timestamp > b->event.timestamp) ? 1 : -1;
+    }
+    else
+    {
+        order = (a->sequence > b->sequence) - (a->sequence < b->sequence);
+    }
+
+    /* Return the order. */
+    return order;
+}
+
+/**
+ * @brief Hash of a (pool, slot) pair (of a caller, with slot 0).
+ */
+static uint64_t
+memPoolTraceDecode_hash (uint64_t pool, uint32_t slot)
+{
+    uint64_t h;
+
+    h = (pool ^ (((uint64_t) slot) * 0x9E3779B97F4A7C15U)) * 0xBF58476D1CE4E5B9U;
+
+    /* Return the hash. */
+    return h ^ (h >> 31U);
+}
+
+/**
+ * @brief Double callsites (array and hash table, rehashed).
+ *
+ * @return true if no error occurred; false if out of memory.
+ */
+static bool
+memPoolTraceDecode_siteGrow (void)
+{
+    memPoolTraceDecode_site_t* ptrSites;
+    uint32_t*                  ptrTable;
+    uint32_t                   capacity;
+    uint32_t                   i;
+    uint64_t                   h;
+    bool                       done;
+
+    capacity = (memPoolTraceDecode_siteCapacity == 0U) ? 64U : (memPoolTraceDecode_siteCapacity * 2U);
+    ptrSites = realloc (memPoolTraceDecode_sites, (capacity * sizeof (*ptrSites)));
+    ptrTable = calloc ((2U * capacity), sizeof (*ptrTable));
+    done     = (ptrSites != NULL) && (ptrTable != NULL);
+
+    if (ptrSites != NULL)
+    {
+        memPoolTraceDecode_sites = ptrSites;
+    }
+
+    if (done == true)
+    {
+        /* Table is kept at most half full. */
+        for (i = 0U; i < memPoolTraceDecode_siteCount; i++)
+        {
+            for (h = memPoolTraceDecode_hash (memPoolTraceDecode_sites[i].caller, 0U) & ((2U * capacity) - 1U);
+                 ptrTable[h] != 0U;
+                 h = (h + 1U) & ((2U * capacity) - 1U))
+            {
+            }
+
+            ptrTable[h] = i + 1U;
+        }
+
+        free (memPoolTraceDecode_siteTable);
+        memPoolTraceDecode_siteTable    = ptrTable;
+        memPoolTraceDecode_siteCapacity = capacity;
+    }
+    else
+    {
+        free (ptrTable);
+    }
+
+    /* Return whether callsites were grown. */
+    return done;
+}
+
+/**
+ * @brief Find the callsite of \p caller (added if new), in O(1).
+ *
+ * @return true if no error occurred; false if out of memory.
+ */
+static bool
+memPoolTraceDecode_site (uint64_t caller, uint32_t* ptrSite)
+{
+    uint64_t h;
+    uint64_t mask;
+    bool     done;
+
+    /* Room for a new one (table at most half full)? */
+    done = (memPoolTraceDecode_siteCount < memPoolTraceDecode_siteCapacity) || memPoolTraceDecode_siteGrow ();
+
+    if (done == true)
+    {
+        mask = (2U * ((uint64_t) memPoolTraceDecode_siteCapacity)) - 1U;
+
+        for (h = memPoolTraceDecode_hash (caller, 0U) & mask;
+             (memPoolTraceDecode_siteTable[h] != 0U) &&
+             (memPoolTraceDecode_sites[memPoolTraceDecode_siteTable[h] - 1U].caller != caller);
+             h = (h + 1U) & mask)
+        {
+        }
+
+        /* New callsite? */
+        if (memPoolTraceDecode_siteTable[h] == 0U)
+        {
+            (void) memset (&memPoolTraceDecode_sites[memPoolTraceDecode_siteCount], 0x00,
+                           sizeof (*memPoolTraceDecode_sites));
+            memPoolTraceDecode_sites[memPoolTraceDecode_siteCount].caller = caller;
+            memPoolTraceDecode_siteCount++;
+            memPoolTraceDecode_siteTable[h] = memPoolTraceDecode_siteCount;
+        }
+
+        *ptrSite = memPoolTraceDecode_siteTable[h] - 1U;
+    }
+
+    /* Return whether callsite was found. */
+    return done;
+}
+
+/**
+ * @brief Find the live entry of (pool, slot), or (if \p insert) a free one
+ *        to fill if none.
+ *
+ * @return Entry found, NULL if none.
+ */
+static memPoolTraceDecode_live_t*
+memPoolTraceDecode_find (uint64_t pool, uint32_t slot, bool insert)
+{
+    memPoolTraceDecode_live_t* ptrFound;
+    memPoolTraceDecode_live_t* ptrFree;
+    uint64_t                   i;
+
+    ptrFound = NULL;
+    ptrFree  = NULL;
+
+    for (i = memPoolTraceDecode_hash (pool, slot) & (memPoolTraceDecode_liveCapacity - 1U);
+         (memPoolTraceDecode_live[i].state != MEM_POOL_TRACE_DECODE_EMPTY) && (ptrFound == NULL);
+         i = (i + 1U) & (memPoolTraceDecode_liveCapacity - 1U))
+    {
+        if ((memPoolTraceDecode_live[i].state == MEM_POOL_TRACE_DECODE_USED) &&
+            (memPoolTraceDecode_live[i].pool  == pool)                      &&
+            (memPoolTraceDecode_live[i].slot  == slot))
+        {
+            ptrFound = &memPoolTraceDecode_live[i];
+        }
+        else if ((memPoolTraceDecode_live[i].state == MEM_POOL_TRACE_DECODE_GONE) && (ptrFree == NULL))
+        {
+            ptrFree = &memPoolTraceDecode_live[i];
+        }
+        else
+        {
+            /* Just do nothing. */
+        }
+    }
+
+    /* Not found: reuse first tombstone, else take the empty entry ending the chain. */
+    if ((ptrFound == NULL) && (insert == true))
+    {
+        if (ptrFree == NULL)
+        {
+            ptrFree = &memPoolTraceDecode_live[i];
+            memPoolTraceDecode_liveTaken++;
+        }
+
+        ptrFound = ptrFree;
+    }
+
+    /* Return the entry found. */
+    return ptrFound;
+}
+
+/**
+ * @brief Double live slots table (rehashed, tombstones dropped).
+ *
+ * @return true if no error occurred; false if out of memory.
+ */
+static bool
+memPoolTraceDecode_liveGrow (void)
+{
+    memPoolTraceDecode_live_t* ptrOld;
+    memPoolTraceDecode_live_t* ptrEntry;
+    uint64_t                   capacity;
+    uint64_t                   i;
+    bool                       done;
+
+    ptrOld   = memPoolTraceDecode_live;
+    capacity = memPoolTraceDecode_liveCapacity;
+
+    memPoolTraceDecode_live = calloc (((capacity == 0U) ? 1024U : (capacity * 2U)), sizeof (*ptrOld));
+    done                    = (memPoolTraceDecode_live != NULL);
+
+    if (done == true)
+    {
+        memPoolTraceDecode_liveCapacity = (capacity == 0U) ? 1024U : (capacity * 2U);
+        memPoolTraceDecode_liveTaken    = 0U;
+
+        for (i = 0U; i < capacity; i++)
+        {
+            if (ptrOld[i].state == MEM_POOL_TRACE_DECODE_USED)
+            {
+                ptrEntry  = memPoolTraceDecode_find (ptrOld[i].pool, ptrOld[i].slot, true);
+                *ptrEntry = ptrOld[i];
+            }
+        }
+
+        free (ptrOld);
+    }
+    else
+    {
+        /* Keep old table. */
+        memPoolTraceDecode_live = ptrOld;
+    }
+
+    /* Return whether table was grown. */
+    return done;
+}
+
+/**
+ * @brief Lifetime histogram bucket (log2) of \p ticks.
+ */
+static uint32_t
+memPoolTraceDecode_bucket (uint64_t ticks)
+{
+    uint32_t bucket;
+
+    for (bucket = 0U; (ticks > 1U) && (bucket < (MEM_POOL_TRACE_DECODE_BUCKETS - 1U)); bucket++)
+    {
+        ticks >>= 1U;
+    }
+
+    /* Return the bucket. */
+    return bucket;
+}
+
+/**
+ * @brief Load all events following the log header.
+ *
+ * @return true if no error occurred; false if out of memory.
+ */
+static bool
+memPoolTraceDecode_load (FILE* ptrFile, memPoolTraceDecode_entry_t** ptr2Entries, uint64_t* ptrCount)
+{
+    memPoolTraceDecode_entry_t* ptrEntries;
+    uint64_t                    capacity;
+    bool                        done;
+    bool                        more;
+
+    *ptr2Entries = NULL;
+    *ptrCount    = 0U;
+    capacity     = 0U;
+    done         = true;
+    more         = true;
+
+    while ((done == true) && (more == true))
+    {
+        /* Full? Double capacity. */
+        if (*ptrCount == capacity)
+        {
+            capacity   = (capacity == 0U) ? 4096U : (capacity * 2U);
+            ptrEntries = realloc (*ptr2Entries, (capacity * sizeof (*ptrEntries)));
+            done       = (ptrEntries != NULL);
+
+            if (done == true)
+            {
+                *ptr2Entries = ptrEntries;
+            }
+        }
+
+        if (done == true)
+        {
+            more = (fread (&(*ptr2Entries)[*ptrCount].event, sizeof (memPoolTrace_event_t), 1U, ptrFile) == 1U);
+
+            if (more == true)
+            {
+                (*ptr2Entries)[*ptrCount].sequence = *ptrCount;
+                (*ptrCount)++;
+            }
+        }
+    }
+
+    /* Return whether events were loaded. */
+    return done;
+}
+
+/**
+ * @brief Pair allocations with frees (events merged), per callsite.
+ *
+ * Frees of slots allocated before log start (or whose allocation was lost)
+ * are counted into \p ptrUnmatched.
+ *
+ * @return true if no error occurred; false if out of memory.
+ */
+static bool
+memPoolTraceDecode_pair (const memPoolTraceDecode_entry_t* ptrEntries, uint64_t count, uint64_t* ptrUnmatched)
+{
+    const memPoolTrace_event_t* ptrEvent;
+    memPoolTraceDecode_live_t*  ptrLive;
+    memPoolTraceDecode_site_t*  ptrSite;
+    uint32_t                    site;
+    uint64_t                    i;
+    bool                        done;
+
+    *ptrUnmatched = 0U;
+    done          = memPoolTraceDecode_liveGrow ();
+
+    for (i = 0U; (i < count) && (done == true); i++)
+    {
+        ptrEvent = &ptrEntries[i].event;
+
+        if (ptrEvent->type == MEM_POOL_TRACE_ALLOC)
+        {
+            /* Table kept at most half taken. */
+            done = ((2U * (memPoolTraceDecode_liveTaken + 1U)) <= memPoolTraceDecode_liveCapacity) ||
+                   memPoolTraceDecode_liveGrow ();
+            done = done && memPoolTraceDecode_site (ptrEvent->caller, &site);
+
+            if (done == true)
+            {
+                /* Slot allocated twice (free lost in an overrun): older allocation forgotten. */
+                ptrLive = memPoolTraceDecode_find (ptrEvent->pool, ptrEvent->slot, false);
+
+                if (ptrLive != NULL)
+                {
+                    memPoolTraceDecode_sites[ptrLive->site].live--;
+                }
+                else
+                {
+                    ptrLive = memPoolTraceDecode_find (ptrEvent->pool, ptrEvent->slot, true);
+                }
+
+                ptrLive->pool      = ptrEvent->pool;
+                ptrLive->slot      = ptrEvent->slot;
+                ptrLive->state     = MEM_POOL_TRACE_DECODE_USED;
+                ptrLive->site      = site;
+                ptrLive->timestamp = ptrEvent->timestamp;
+
+                memPoolTraceDecode_sites[site].allocs++;
+                memPoolTraceDecode_sites[site].live++;
+            }
+        }
+        else
+        {
+            ptrLive = memPoolTraceDecode_find (ptrEvent->pool, ptrEvent->slot, false);
+
+            /* Allocated before the log starts (or event lost)? */
+            if (ptrLive == NULL)
+            {
+                (*ptrUnmatched)++;
+            }
+            else
+            {
+                ptrSite = &memPoolTraceDecode_sites[ptrLive->site];
+                ptrSite->frees++;
+                ptrSite->live--;
+                ptrSite->lifetimes[memPoolTraceDecode_bucket (ptrEvent->timestamp - ptrLive->timestamp)]++;
+                ptrLive->state = MEM_POOL_TRACE_DECODE_GONE;
+            }
+        }
+    }
+
+    /* Return whether events were paired. */
+    return done;
+}
+
+/**
+ * @brief Print callsites, then lifetime histograms (CSV).
+ */
+static void
+memPoolTraceDecode_print (void)
+{
+    uint32_t i;
+    uint32_t j;
+
+    printf ("callsite,allocs,frees,live\n");
+
+    for (i = 0U; i < memPoolTraceDecode_siteCount; i++)
+    {
+        printf ("0x%llx,%llu,%llu,%llu\n", (unsigned long long) memPoolTraceDecode_sites[i].caller,
+                (unsigned long long) memPoolTraceDecode_sites[i].allocs,
+                (unsigned long long) memPoolTraceDecode_sites[i].frees,
+                (unsigned long long) memPoolTraceDecode_sites[i].live);
+    }
+
+    printf ("\ncallsite,lifetime_log2,frees\n");
+
+    for (i = 0U; i < memPoolTraceDecode_siteCount; i++)
+    {
+        for (j = 0U; j < MEM_POOL_TRACE_DECODE_BUCKETS; j++)
+        {
+            if (memPoolTraceDecode_sites[i].lifetimes[j] != 0U)
+            {
+                printf ("0x%llx,%u,%llu\n", (unsigned long long) memPoolTraceDecode_sites[i].caller, j,
+                        (unsigned long long) memPoolTraceDecode_sites[i].lifetimes[j]);
+            }
+        }
+    }
+}
+
+/* ************************************************************************** *
+ *                      End of private function section                       *
+ * ************************************************************************** */
+
+
+/* ************************************************************************** *
+ *                      Start of global function section                      *
+ * ************************************************************************** */
+
+int
+main (int argc, char** argv)
+{
+    memPoolTrace_fileHeader_t   header;
+    memPoolTraceDecode_entry_t* ptrEntries;
+    uint64_t                    count;
+    uint64_t                    unmatched;
+    FILE*                       ptrFile;
+    int                         status;
+
+    ptrEntries = NULL;
+    ptrFile    = (argc == 2) ? fopen (argv[1], "rb") : NULL;
+
+    if (argc != 2)
+    {
+        fprintf (stderr, "usage: %s <trace log>\n", argv[0]);
+        status = EXIT_FAILURE;
+    }
+    else if ((ptrFile == NULL)                                             ||
+             (fread (&header, sizeof (header), 1U, ptrFile) != 1U)         ||
+             (header.magic     != MEM_POOL_TRACE_MAGIC)                    ||
+             (header.eventSize != sizeof (memPoolTrace_event_t)))
+    {
+        fprintf (stderr, "%s: not a trace log (or other format version)\n", argv[1]);
+        status = EXIT_FAILURE;
+    }
+    else if (memPoolTraceDecode_load (ptrFile, &ptrEntries, &count) == false)
+    {
+        fprintf (stderr, "out of memory\n");
+        status = EXIT_FAILURE;
+    }
+    else
+    {
+        /* Merge threads (rings are drained out of order). */
+        qsort (ptrEntries, count, sizeof (*ptrEntries), memPoolTraceDecode_compare);
+
+        /* Pair allocations with frees. */
+        if (memPoolTraceDecode_pair (ptrEntries, count, &unmatched) == false)
+        {
+            fprintf (stderr, "out of memory\n");
+            status = EXIT_FAILURE;
+        }
+        else
+        {
+            fprintf (stderr,
+                     "%llu events, %u callsites, %llu frees of slots allocated before log start, timestamps in %s\n",
+                     (unsigned long long) count, memPoolTraceDecode_siteCount, (unsigned long long) unmatched,
+                     (header.clock == MEM_POOL_TRACE_CLOCK_TSC) ? "TSC ticks" : "ns");
+
+            memPoolTraceDecode_print ();
+            status = EXIT_SUCCESS;
+        }
+    }
+
+    if (ptrFile != NULL)
+    {
+        (void) fclose (ptrFile);
+    }
+
+    free (ptrEntries);
+    free (memPoolTraceDecode_live);
+    free (memPoolTraceDecode_sites);
+    free (memPoolTraceDecode_siteTable);
+
+    /* Return the exit status. */
+    return status;
+}
+
+/* ************************************************************************** *
+ *                       End of global function section                       *
+ * ************************************************************************** */